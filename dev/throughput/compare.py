@@ -0,0 +1,67 @@
+"""
+Compare the results of run.py with a baseline, and flag regressions.
+
+A case regresses if it fails to run, if its trials per second decrease by
+more than the given fraction of the baseline, or if its energy drift exceeds
+the given absolute tolerance and the drift of the baseline.
+Returns a non-zero exit code if any case regresses.
+
+Usage: python compare.py results.json --baseline baseline.json
+"""
+
+import argparse
+import json
+import sys
+
+PARSER = argparse.ArgumentParser(formatter_class=argparse.ArgumentDefaultsHelpFormatter)
+PARSER.add_argument('results', type=str, help='file name of the JSON results of run.py')
+PARSER.add_argument('--baseline', type=str, default='baseline.json',
+    help='file name of the JSON results of run.py to compare with')
+PARSER.add_argument('--max_slowdown', type=float, default=0.1,
+    help='maximum fractional decrease in trials per second')
+PARSER.add_argument('--drift_tolerance', type=float, default=1e-6,
+    help='absolute energy drift which is not considered a regression')
+
+def compare(results, baseline, max_slowdown, drift_tolerance):
+    """ Return a list of regressions and print a table of the comparison. """
+    regressions = list()
+    print('case,trials_per_second,baseline,change,energy_drift,baseline_drift')
+    for case, base in baseline['cases'].items():
+        if case not in results['cases']:
+            print(case + ',missing')
+            continue
+        result = results['cases'][case]
+        if result['exit_code'] != 0:
+            regressions.append(case + ' failed with exit code ' + str(result['exit_code']))
+            continue
+        if base['exit_code'] != 0:
+            continue
+        change = result['trials_per_second']/base['trials_per_second'] - 1.
+        print(','.join([case, str(result['trials_per_second']),
+                        str(base['trials_per_second']), '{:+.1%}'.format(change),
+                        str(result['energy_drift']), str(base['energy_drift'])]))
+        if change < -max_slowdown:
+            regressions.append('{} trials_per_second decreased by {:.1%}'.format(case, -change))
+        if result['energy_drift'] > max(drift_tolerance, base['energy_drift']):
+            regressions.append('{} energy_drift increased to {}'.format(
+                case, result['energy_drift']))
+    if results['num_trials'] != baseline['num_trials']:
+        print('Warning: num_trials differ from baseline')
+    return regressions
+
+def main():
+    """ Compare results with the baseline and exit with non-zero if regressed. """
+    args = PARSER.parse_args()
+    with open(args.results, 'r', encoding='utf-8') as file:
+        results = json.load(file)
+    with open(args.baseline, 'r', encoding='utf-8') as file:
+        baseline = json.load(file)
+    regressions = compare(results, baseline, args.max_slowdown, args.drift_tolerance)
+    for regression in regressions:
+        print('REGRESSION:', regression)
+    if regressions:
+        sys.exit(1)
+    print('No regressions.')
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,279 @@
+"""
+Run an end-to-end throughput regression suite of standard ensembles.
+
+Each case is adapted from a tutorial, and runs for a fixed number of trials
+with a fixed seed after initialization.
+The trials per second are measured with Throughput, and the energy drift
+(the difference between the recomputed and running energy at the end of the
+run) is measured with CheckEnergy.
+The results are written in JSON, and may be compared with a baseline using
+compare.py.
+
+Usage: python run.py --feasst_install ../../build/ --output results.json
+"""
+
+import argparse
+import json
+import math
+import os
+import subprocess
+import time
+
+PARSER = argparse.ArgumentParser(formatter_class=argparse.ArgumentDefaultsHelpFormatter)
+PARSER.add_argument('--feasst_install', type=str, default='../../build/',
+    help='FEASST install directory (e.g., the path to build)')
+PARSER.add_argument('--output', type=str, default='results.json',
+    help='file name of the JSON results')
+PARSER.add_argument('--num_trials', type=int, default=int(1e5),
+    help='number of trials of each case after initialization')
+PARSER.add_argument('--seed', type=int, default=1346867550, help='random number seed')
+PARSER.add_argument('--cases', type=str, default='all',
+    help='comma-separated list of cases to run, or all')
+PARSER.add_argument('--work_dir', type=str, default='throughput_work',
+    help='directory for the scripts and output of each case')
+
+# The timed portion of each case is appended to each script.
+TIMED = """
+CheckEnergy trials_per_update {num_trials} tolerance 1e10 file_name {case}_drift.txt
+Throughput trials_per_write {num_trials} file_name {case}_throughput.csv
+Run num_trials {num_trials}
+"""
+
+# tutorial/launch.py
+LJ_NVT = """
+MonteCarlo
+RandomMT19937 seed {seed}
+Configuration cubic_side_length 8 particle_type0 /feasst/particle/lj.fstprt
+Potential Model LennardJones VisitModel VisitModelCell min_length max_cutoff
+Potential VisitModel LongRangeCorrections
+ThermoParams beta 1.111111111111 chemical_potential -1
+Metropolis
+TrialTranslate tunable_param 2 tunable_target_acceptance 0.2
+TrialAdd particle_type 0
+Run until_num_particles 256
+RemoveTrial name TrialAdd
+"""
+
+# plugin/flat_histogram/tutorial/launch_04_lj_tm_parallel.py
+LJ_GCMC_TM = """
+MonteCarlo
+RandomMT19937 seed {seed}
+Configuration cubic_side_length 8 particle_type0 /feasst/particle/lj.fstprt
+Potential Model LennardJones
+Potential VisitModel LongRangeCorrections
+ThermoParams beta 0.6666666666667 chemical_potential -2.352
+FlatHistogram Macrostate MacrostateNumParticles width 1 max 50 min 0 \
+Bias TransitionMatrix min_sweeps 1000
+TrialTranslate weight 1 tunable_param 0.2 tunable_target_acceptance 0.25
+TrialTransfer weight 2 particle_type 0
+"""
+
+# plugin/charge/tutorial/launch_1_spce_nvt.py
+SPCE_EWALD = """
+MonteCarlo
+RandomMT19937 seed {seed}
+Configuration cubic_side_length 15 particle_type0 /feasst/particle/spce.fstprt physical_constants CODATA2010 cutoff 7.5
+Potential VisitModel Ewald alpha 0.37333333333 kmax_squared 38
+Potential Model ModelTwoBodyFactory model0 LennardJones model1 ChargeScreened VisitModel VisitModelCutoffOuter table_size 1e6
+Potential Model ChargeScreenedIntra VisitModel VisitModelBond
+Potential Model ChargeSelf
+Potential VisitModel LongRangeCorrections
+ThermoParams beta 0.4036774 chemical_potential 1
+Metropolis
+TrialTranslate tunable_param 2 tunable_target_acceptance 0.2
+TrialParticlePivot weight 0.5 particle_type 0 tunable_param 0.5 tunable_target_acceptance 0.25
+TrialAdd particle_type 0
+Run until_num_particles 100
+RemoveTrial name TrialAdd
+"""
+
+# plugin/flat_histogram/tutorial/launch_11_trappe_alkane.py
+BUTANE_CB = """
+MonteCarlo
+RandomMT19937 seed {seed}
+Configuration cubic_side_length 30 particle_type0 /feasst/particle/n-butane.fstprt cutoff 14
+Potential Model LennardJones
+Potential Model LennardJones VisitModel VisitModelIntra intra_cut 4
+Potential VisitModel LongRangeCorrections
+RefPotential Model LennardJones VisitModel VisitModelCell min_length 5 reference_index 0
+RefPotential Model LennardJones VisitModel VisitModelIntra intra_cut 4 reference_index 0
+ThermoParams beta 0.3436 chemical_potential 10
+Metropolis
+TrialTranslate weight 1 tunable_param 0.2 tunable_target_acceptance 0.25
+TrialParticlePivot weight 0.25 particle_type 0 tunable_param 0.2 tunable_target_acceptance 0.25 pivot_site 0
+TrialParticlePivot weight 0.25 particle_type 0 tunable_param 0.2 tunable_target_acceptance 0.25 pivot_site 3
+TrialGrowFile file_name {case}_grow_canonical.txt
+TrialGrowFile file_name {case}_grow_grand_canonical.txt
+Run until_num_particles 30
+RemoveTrial name_contains add
+RemoveTrial name_contains remove
+"""
+
+# plugin/flat_histogram/tutorial/launch_09_kf_tm_parallel.py
+PATCHY_KF = """
+MonteCarlo
+RandomMT19937 seed {seed}
+Configuration cubic_side_length 8 particle_type0 /feasst/plugin/patch/particle/two_patch_linear.fstprt \
+  patch_angle1 {patch_angle} group0 centers centers_site_type0 0
+Potential Model HardSphere VisitModel VisitModelCell min_length 1 cell_group centers group centers
+Potential Model SquareWell VisitModel VisitModelCell min_length 1.5 cell_group centers \
+  VisitModelInner VisitModelInnerPatch group centers
+ThermoParams beta 1.428571428571 chemical_potential 10
+Metropolis
+TrialTranslate weight 1 tunable_param 0.2 tunable_target_acceptance 0.25
+TrialRotate weight 1 tunable_param 0.2 tunable_target_acceptance 0.25
+TrialAdd particle_type 0
+Run until_num_particles 50
+RemoveTrial name TrialAdd
+"""
+
+# plugin/confinement/tutorial/tutorial.ipynb, with the slab given by a table
+CONFINED_LJ_TABLE = """
+MonteCarlo
+RandomMT19937 seed {seed}
+Configuration cubic_side_length 8 particle_type0 /feasst/particle/lj.fstprt
+Potential Model LennardJones
+Potential VisitModel LongRangeCorrections
+Potential Model ModelTableCart3DIntegr file_name {case}_table.txt
+ThermoParams beta 1.5 chemical_potential0 1
+Metropolis
+TrialTranslate weight 1 tunable_param 2
+TrialAdd particle_type 0
+Run until_num_particles 50
+RemoveTrial name TrialAdd
+"""
+
+CASES = {
+    'lj_nvt': LJ_NVT,
+    'lj_gcmc_tm': LJ_GCMC_TM,
+    'spce_ewald': SPCE_EWALD,
+    'butane_cb': BUTANE_CB,
+    'patchy_kf': PATCHY_KF,
+    'confined_lj_table': CONFINED_LJ_TABLE,
+}
+
+def write_grow_file(file_name, num_sites, gce):
+    """ Write TrialGrowFile as in launch_11_trappe_alkane.py. """
+    def partial(site):
+        if num_sites == 2:
+            return site['bond']
+        if num_sites == 3:
+            return site['angle']
+        return site['dihedral']
+    with open(file_name, 'w', encoding='utf-8') as file:
+        file.write("TrialGrowFile\n\n")
+        for inv in [True, False]:
+            for trial_type in [0, 1, 2]: # 0: reptate, 1: full regrow, 2: partial regrow
+                for site in range(num_sites):
+                    sign = -1
+                    if (trial_type == 0 or trial_type == 2) and site != num_sites - 1:
+                        sign = 1
+                    sites = dict()
+                    for i in range(4):
+                        sites['site'+str(i)] = site + sign*i
+                        if inv:
+                            sites['site'+str(i)] = num_sites - site - 1 - sign*i
+                    sites['bond'] = "bond true mobile_site {site0} anchor_site {site1} num_steps 4 reference_index 0\n".format(**sites)
+                    sites['angle'] = "angle true mobile_site {site0} anchor_site {site1} anchor_site2 {site2} num_steps 4 reference_index 0\n".format(**sites)
+                    sites['dihedral'] = "dihedral true mobile_site {site0} anchor_site {site1} anchor_site2 {site2} anchor_site3 {site3} num_steps 4 reference_index 0\n".format(**sites)
+                    if trial_type == 1 and gce:
+                        if site == 0:
+                            file.write("particle_type 0 weight 2 transfer true site {site0} num_steps 4 reference_index 0\n".format(**sites))
+                        elif site == 1:
+                            file.write(sites['bond'])
+                        elif site == 2:
+                            file.write(sites['angle'])
+                        else:
+                            file.write(sites['dihedral'])
+                    elif trial_type == 0 and not gce:
+                        if site == num_sites - 1:
+                            file.write(partial(sites))
+                        else:
+                            if site == 0:
+                                file.write("particle_type 0 weight 2 ")
+                            file.write("reptate true mobile_site {site0} anchor_site {site1} num_steps 1 reference_index 0\n".format(**sites))
+                    if not gce and trial_type == 2 and site == 0:
+                        file.write("particle_type 0 weight 2 ")
+                        file.write(partial(sites))
+                file.write("\n")
+
+def write_table_file(file_name, num=21, cubic_side_length=8):
+    """
+    Write a ModelTableCart3DIntegr table of an attractive 9-3 slab wall,
+    given by normal distance in the third dimension.
+    The table is indexed by the normalized distance from the center, 2|x|/L,
+    and the wall is 0.5 beyond the boundary of the domain.
+    """
+    values = list()
+    for bin2 in range(num):
+        dist = 0.5*cubic_side_length*(1 - bin2/(num - 1)) + 0.5
+        values.append(2./15.*dist**-9 - dist**-3)
+    with open(file_name, 'w', encoding='utf-8') as file:
+        file.write("site_types 1 0\n6867 " + str(num) + " ")
+        for _ in range(num):
+            file.write(str(num) + " ")
+            for _ in range(num):
+                file.write(str(num) + " " + " ".join(repr(v) for v in values) + " ")
+        file.write("\n")
+
+def prepare(case, params):
+    """ Write auxiliary files and return the script of a case. """
+    if case == 'butane_cb':
+        write_grow_file(case+'_grow_canonical.txt', num_sites=4, gce=False)
+        write_grow_file(case+'_grow_grand_canonical.txt', num_sites=4, gce=True)
+    elif case == 'confined_lj_table':
+        write_table_file(case+'_table.txt')
+    return (CASES[case] + TIMED).format(**params)
+
+def read_csv_row(file_name):
+    """ Return the last row of a csv file with a header as a dictionary. """
+    with open(file_name, 'r', encoding='utf-8') as file:
+        lines = [line.strip() for line in file if line.strip()]
+    header = lines[0].split(',')
+    return dict(zip(header, [float(x) for x in lines[-1].split(',')]))
+
+def run_case(case, args):
+    """ Run a case and return its results. """
+    params = {'case': case, 'seed': args.seed, 'num_trials': args.num_trials,
+              'patch_angle': 2*math.asin(math.sqrt(0.7/2))*180/math.pi}
+    script = prepare(case, params)
+    with open(case+'.txt', 'w', encoding='utf-8') as file:
+        file.write(script)
+    begin = time.time()
+    with open(case+'.log', 'w', encoding='utf-8') as log:
+        with open(case+'.txt', 'r', encoding='utf-8') as stdin:
+            code = subprocess.call([os.path.join(args.feasst_install, 'bin', 'fst')],
+                                   stdin=stdin, stdout=log, stderr=subprocess.STDOUT)
+    result = {'exit_code': code, 'wall_seconds': time.time() - begin}
+    if code == 0:
+        throughput = read_csv_row(case+'_throughput.csv')
+        drift = read_csv_row(case+'_drift.txt')
+        result['trials'] = int(throughput['trials'])
+        result['trials_per_second'] = throughput['trials_per_second']
+        result['pairs_per_second'] = throughput['pairs_per_second']
+        result['memory_kb'] = throughput['memory_kb']
+        result['energy'] = drift['energy']
+        result['energy_drift'] = abs(drift['difference'])
+    return result
+
+def main():
+    """ Run the cases and write the results. """
+    args = PARSER.parse_args()
+    args.feasst_install = os.path.abspath(args.feasst_install)
+    output = os.path.abspath(args.output)
+    cases = list(CASES.keys())
+    if args.cases != 'all':
+        cases = args.cases.split(',')
+    os.makedirs(args.work_dir, exist_ok=True)
+    os.chdir(args.work_dir)
+    results = {'num_trials': args.num_trials, 'seed': args.seed, 'cases': dict()}
+    for case in cases:
+        assert case in CASES, 'unrecognized case: ' + case
+        print('Running', case)
+        results['cases'][case] = run_case(case, args)
+        print(json.dumps(results['cases'][case]))
+    with open(output, 'w', encoding='utf-8') as file:
+        json.dump(results, file, indent=2)
+
+if __name__ == '__main__':
+    main()
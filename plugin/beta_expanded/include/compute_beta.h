@@ -47,6 +47,9 @@ Application of local detailed balance yields the acceptance probability,
 
 :math:`\chi = e^{-(\beta_n - \beta_o) U}`
 
+Because the energy does not change, the energy of the new state is the current
+energy of the Criteria, and no energy is computed.
+
 \endrst
  */
 class ComputeBeta : public TrialCompute {
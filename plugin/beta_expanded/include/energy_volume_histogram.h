@@ -0,0 +1,129 @@
+#ifndef FEASST_BETA_EXPANDED_ENERGY_VOLUME_HISTOGRAM_H_
+#define FEASST_BETA_EXPANDED_ENERGY_VOLUME_HISTOGRAM_H_
+
+#include <map>
+#include <memory>
+#include <utility>
+#include <vector>
+#include "monte_carlo/include/analyze.h"
+
+namespace feasst {
+
+class LnProbability;
+
+/**
+  Accumulate a joint histogram of the energy and volume for histogram
+  reweighting.
+  Use the multistate argument to obtain a histogram for each MacrostateBeta,
+  so that thermodynamic properties at intermediate values of \f$\beta\f$ can
+  be obtained by multiple histogram reweighting in post-processing, without
+  additional simulations (see reweight_energy).
+
+  The energy and volume bins are centered at integer multiples of their
+  widths, and only the bins which have been visited are stored.
+  Each line of the output file contains the energy and volume at the center of
+  a bin, followed by the number of observations.
+ */
+class EnergyVolumeHistogram : public Analyze {
+ public:
+  /**
+    args:
+    - energy_width: width of the energy bins (default: 1).
+    - volume_width: width of the volume bins (default: 1).
+   */
+  explicit EnergyVolumeHistogram(argtype args = argtype());
+  explicit EnergyVolumeHistogram(argtype * args);
+
+  std::string header(const Criteria& criteria,
+    const System& system,
+    const TrialFactory& trials) const override;
+
+  void initialize(Criteria * criteria,
+      System * system,
+      TrialFactory * trial_factory) override;
+
+  void update(const Criteria& criteria,
+      const System& system,
+      const TrialFactory& trial_factory) override;
+
+  std::string write(const Criteria& criteria,
+      const System& system,
+      const TrialFactory& trial_factory) override;
+
+  /// Return the width of the energy bins.
+  double energy_width() const { return energy_width_; }
+
+  /// Return the width of the volume bins.
+  double volume_width() const { return volume_width_; }
+
+  /// Return the inverse temperature of the last update.
+  double beta() const { return beta_; }
+
+  /// Return the number of visited bins.
+  int num_bins() const { return static_cast<int>(counts_.size()); }
+
+  /// Return the energy at the center of the visited bin.
+  double energy(const int bin) const { return energy_width_*energy_bins_[bin]; }
+
+  /// Return the volume at the center of the visited bin.
+  double volume(const int bin) const { return volume_width_*volume_bins_[bin]; }
+
+  /// Return the number of observations in the visited bin.
+  double count(const int bin) const { return counts_[bin]; }
+
+  /// Return the total number of observations.
+  double num_values() const { return num_values_; }
+
+  // serialize
+  std::string class_name() const override {
+    return std::string("EnergyVolumeHistogram"); }
+  std::shared_ptr<Analyze> create(std::istream& istr) const override {
+    return std::make_shared<EnergyVolumeHistogram>(istr); }
+  std::shared_ptr<Analyze> create(argtype * args) const override {
+    return std::make_shared<EnergyVolumeHistogram>(args); }
+  void serialize(std::ostream& ostr) const override;
+  explicit EnergyVolumeHistogram(std::istream& istr);
+  explicit EnergyVolumeHistogram(const Analyze& energy_volume_histogram);
+
+ private:
+  double energy_width_;
+  double volume_width_;
+  double beta_ = 0.;
+  double num_values_ = 0.;
+  std::vector<int> energy_bins_;
+  std::vector<int> volume_bins_;
+  std::vector<double> counts_;
+
+  // temporary and not serialized
+  std::map<std::pair<int, int>, int> index_;
+};
+
+inline std::shared_ptr<EnergyVolumeHistogram> MakeEnergyVolumeHistogram(
+    argtype args = argtype()) {
+  return std::make_shared<EnergyVolumeHistogram>(args);
+}
+
+/**
+  Return the average energy at the inverse temperature, beta, by multiple
+  histogram reweighting.
+  https://doi.org/10.1103/PhysRevLett.63.1195
+
+  The histograms are those of a multistate EnergyVolumeHistogram, in the same
+  order as the macrostates of the MacrostateBeta.
+  Because the probability of each macrostate in the beta expanded ensemble is
+  proportional to its partition function, the natural logarithm of the
+  partition functions are given by the ln_prob of the FlatHistogram, and no
+  iteration is required.
+
+  This assumes that beta is the only parameter which changes between the
+  histograms, and that beta does not appear in the acceptance criteria other
+  than as a Boltzmann factor of the energy (e.g., the canonical ensemble).
+ */
+double reweight_energy(
+  const std::vector<std::shared_ptr<Analyze> >& histograms,
+  const LnProbability& ln_prob,
+  const double beta);
+
+}  // namespace feasst
+
+#endif  // FEASST_BETA_EXPANDED_ENERGY_VOLUME_HISTOGRAM_H_
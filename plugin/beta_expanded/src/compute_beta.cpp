@@ -23,7 +23,15 @@ void ComputeBeta::perturb_and_acceptance(
     Random * random) {
   DEBUG("ComputeBeta");
   const double beta_old = system->thermo_params().beta();
-  compute_rosenbluth(0, criteria, system, acceptance, stages, random);
+  // The energy does not change, so avoid its computation in the stages.
+  ASSERT(stages->size() == 1, "assumes one stage");
+  TrialStage * stage = (*stages)[0];
+  stage->perturb_only(system, random);
+  if (!stage->are_constraints_satisfied(0, *system)) {
+    acceptance->add_to_ln_metropolis_prob(-1e100);
+  }
+  acceptance->set_perturbed_state(stage->trial_select().mobile().trial_state(),
+    stage->trial_select().configuration_index());
   const double beta_new = system->thermo_params().beta();
   acceptance->set_energy_new(criteria->current_energy());
   acceptance->set_energy_profile_new(criteria->current_energy_profile());
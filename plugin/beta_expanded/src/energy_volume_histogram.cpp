@@ -0,0 +1,170 @@
+#include <cmath>
+#include "utils/include/serialize.h"
+#include "math/include/constants.h"
+#include "configuration/include/domain.h"
+#include "flat_histogram/include/ln_probability.h"
+#include "beta_expanded/include/energy_volume_histogram.h"
+
+namespace feasst {
+
+class MapEnergyVolumeHistogram {
+ public:
+  MapEnergyVolumeHistogram() {
+    auto obj = MakeEnergyVolumeHistogram();
+    obj->deserialize_map()["EnergyVolumeHistogram"] = obj;
+  }
+};
+
+static MapEnergyVolumeHistogram mapper_ = MapEnergyVolumeHistogram();
+
+EnergyVolumeHistogram::EnergyVolumeHistogram(argtype * args) : Analyze(args) {
+  energy_width_ = dble("energy_width", args, 1.);
+  volume_width_ = dble("volume_width", args, 1.);
+  ASSERT(energy_width_ > 0, "energy_width: " << energy_width_);
+  ASSERT(volume_width_ > 0, "volume_width: " << volume_width_);
+}
+EnergyVolumeHistogram::EnergyVolumeHistogram(argtype args)
+  : EnergyVolumeHistogram(&args) {
+  FEASST_CHECK_ALL_USED(args);
+}
+
+void EnergyVolumeHistogram::initialize(Criteria * criteria,
+    System * system,
+    TrialFactory * trial_factory) {
+  printer(header(*criteria, *system, *trial_factory),
+          file_name(*criteria));
+}
+
+std::string EnergyVolumeHistogram::header(const Criteria& criteria,
+    const System& system,
+    const TrialFactory& trial_factory) const {
+  std::stringstream ss;
+  ss << "#\"beta\":" << MAX_PRECISION << beta_ << std::endl;
+  ss << "energy,volume,count" << std::endl;
+  return ss.str();
+}
+
+void EnergyVolumeHistogram::update(const Criteria& criteria,
+    const System& system,
+    const TrialFactory& trial_factory) {
+  beta_ = system.thermo_params().beta();
+  const std::pair<int, int> bins(
+    static_cast<int>(std::round(criteria.current_energy()/energy_width_)),
+    static_cast<int>(std::round(
+      system.configuration().domain().volume()/volume_width_)));
+  auto pair = index_.find(bins);
+  if (pair == index_.end()) {
+    index_[bins] = static_cast<int>(counts_.size());
+    energy_bins_.push_back(bins.first);
+    volume_bins_.push_back(bins.second);
+    counts_.push_back(1.);
+  } else {
+    counts_[pair->second] += 1.;
+  }
+  num_values_ += 1.;
+}
+
+std::string EnergyVolumeHistogram::write(const Criteria& criteria,
+    const System& system,
+    const TrialFactory& trial_factory) {
+  // print the header every time because beta is not known at initialization.
+  std::stringstream ss;
+  ss << header(criteria, system, trial_factory);
+  for (int bin = 0; bin < num_bins(); ++bin) {
+    ss << MAX_PRECISION << energy(bin) << "," << volume(bin) << ","
+       << count(bin) << std::endl;
+  }
+  return ss.str();
+}
+
+void EnergyVolumeHistogram::serialize(std::ostream& ostr) const {
+  Stepper::serialize(ostr);
+  feasst_serialize_version(4327, ostr);
+  feasst_serialize(energy_width_, ostr);
+  feasst_serialize(volume_width_, ostr);
+  feasst_serialize(beta_, ostr);
+  feasst_serialize(num_values_, ostr);
+  feasst_serialize(energy_bins_, ostr);
+  feasst_serialize(volume_bins_, ostr);
+  feasst_serialize(counts_, ostr);
+}
+
+EnergyVolumeHistogram::EnergyVolumeHistogram(std::istream& istr)
+  : Analyze(istr) {
+  const int version = feasst_deserialize_version(istr);
+  ASSERT(version == 4327, "mismatch version:" << version);
+  feasst_deserialize(&energy_width_, istr);
+  feasst_deserialize(&volume_width_, istr);
+  feasst_deserialize(&beta_, istr);
+  feasst_deserialize(&num_values_, istr);
+  feasst_deserialize(&energy_bins_, istr);
+  feasst_deserialize(&volume_bins_, istr);
+  feasst_deserialize(&counts_, istr);
+  for (int bin = 0; bin < num_bins(); ++bin) {
+    index_[std::make_pair(energy_bins_[bin], volume_bins_[bin])] = bin;
+  }
+}
+
+EnergyVolumeHistogram::EnergyVolumeHistogram(
+    const Analyze& energy_volume_histogram) {
+  std::stringstream ss;
+  energy_volume_histogram.serialize(ss);
+  *this = EnergyVolumeHistogram(ss);
+}
+
+// Return the natural log of the sum of the exponentials.
+static double ln_sum_exp_(const std::vector<double>& values) {
+  double max = -NEAR_INFINITY;
+  for (const double value : values) {
+    max = std::max(max, value);
+  }
+  double sum = 0.;
+  for (const double value : values) {
+    sum += std::exp(value - max);
+  }
+  return max + std::log(sum);
+}
+
+double reweight_energy(
+    const std::vector<std::shared_ptr<Analyze> >& histograms,
+    const LnProbability& ln_prob,
+    const double beta) {
+  const int num_states = static_cast<int>(histograms.size());
+  ASSERT(num_states == ln_prob.size(), "number of histograms: " << num_states
+    << " does not match the size of ln_prob: " << ln_prob.size());
+  std::vector<const EnergyVolumeHistogram*> hists;
+  for (const std::shared_ptr<Analyze>& histogram : histograms) {
+    hists.push_back(
+      dynamic_cast<const EnergyVolumeHistogram*>(histogram.get()));
+    ASSERT(hists.back(), "requires EnergyVolumeHistogram");
+  }
+
+  // sum the histograms of each energy, over states and volumes.
+  std::map<double, double> sum_counts;
+  for (const EnergyVolumeHistogram * hist : hists) {
+    for (int bin = 0; bin < hist->num_bins(); ++bin) {
+      sum_counts[hist->energy(bin)] += hist->count(bin);
+    }
+  }
+
+  // compute the natural log of the density of states and reweight.
+  std::vector<double> ln_weights, energies, terms(num_states);
+  for (const std::pair<const double, double>& sum_count : sum_counts) {
+    const double energy = sum_count.first;
+    for (int state = 0; state < num_states; ++state) {
+      terms[state] = std::log(hists[state]->num_values())
+        - hists[state]->beta()*energy - ln_prob.value(state);
+    }
+    const double ln_dos = std::log(sum_count.second) - ln_sum_exp_(terms);
+    ln_weights.push_back(ln_dos - beta*energy);
+    energies.push_back(energy);
+  }
+  const double ln_norm = ln_sum_exp_(ln_weights);
+  double average = 0.;
+  for (int index = 0; index < static_cast<int>(energies.size()); ++index) {
+    average += energies[index]*std::exp(ln_weights[index] - ln_norm);
+  }
+  return average;
+}
+
+}  // namespace feasst
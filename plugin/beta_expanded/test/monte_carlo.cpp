@@ -20,6 +20,7 @@
 #include "flat_histogram/include/wltm.h"
 #include "beta_expanded/include/trial_beta.h"
 #include "beta_expanded/include/macrostate_beta.h"
+#include "beta_expanded/include/energy_volume_histogram.h"
 
 namespace feasst {
 
@@ -57,7 +58,37 @@ TEST(MonteCarlo, beta_expanded) {
     {"trials_per_update", "1"},
     {"trials_per_write", trials_per},
     {"multistate", "true"}}));
+  mc.add(MakeEnergyVolumeHistogram({
+    {"file_name", "tmp/lj_beta_hist"},
+    {"energy_width", "0.01"},
+    {"trials_per_write", trials_per},
+    {"multistate", "true"}}));
   mc.attempt(5e4);
+
+  const std::vector<std::shared_ptr<Analyze> >& hists =
+    mc.analyzers().back()->analyzers();
+  const std::vector<std::shared_ptr<Analyze> >& energies =
+    mc.analyzers()[mc.num_analyzers() - 2]->analyzers();
+  EXPECT_EQ(beta_num, static_cast<int>(hists.size()));
+  for (int state = 0; state < beta_num; ++state) {
+    const auto& hist = dynamic_cast<const EnergyVolumeHistogram&>(
+      *hists[state]);
+    EXPECT_NEAR(beta_min + state*(beta_max - beta_min)/(beta_num - 1),
+                hist.beta(), NEAR_ZERO);
+    EXPECT_DOUBLE_EQ(energies[state]->accumulator().num_values(),
+                     hist.num_values());
+    EXPECT_DOUBLE_EQ(512., hist.volume(0));
+  }
+  const LnProbability& ln_prob = mc.criteria().flat_histogram().ln_prob();
+  const double en_hot = reweight_energy(hists, ln_prob, beta_min);
+  const double en_mid = reweight_energy(hists, ln_prob, 0.5*(beta_min + beta_max));
+  const double en_cold = reweight_energy(hists, ln_prob, beta_max);
+  EXPECT_GT(en_hot, en_mid);
+  EXPECT_GT(en_mid, en_cold);
+  auto hist2 = test_serialize<EnergyVolumeHistogram, Analyze>(
+    dynamic_cast<const EnergyVolumeHistogram&>(*hists[0]));
+  EXPECT_EQ(hists[0]->write(mc.criteria(), mc.system(), mc.trials()),
+            hist2->write(mc.criteria(), mc.system(), mc.trials()));
 }
 
 //MonteCarlo sweeptest(const int min_sweeps, const int beta_num) {
@@ -136,11 +136,33 @@ class Ewald : public VisitModel {
       Configuration * config,
       const int group_index) override;
 
+  /**
+    Same as base class, except that the structure factor of a state 1, "move",
+    is reset to that after the state 0 removal of the selection before each
+    candidate.
+   */
+  void compute_candidates(
+      Model * model,
+      const ModelParams& model_params,
+      const Select& selection,
+      const std::vector<std::vector<Position> >& candidates,
+      Configuration * config,
+      const int group_index,
+      std::vector<double> * energies) override;
+
   void change_volume(const double delta_volume, const int dimension) override;
 
   // update structure factors and eiks based on new calculations.
   void finalize(const Select& select, Configuration * config) override;
 
+  // discard new calculations, so that a later finalize does not use them.
+  void revert(const Select& select) override {
+    VisitModel::revert(select);
+    finalizable_ = false; }
+
+  /// Return the number of updates of the structure factors.
+  int64_t num_updates() const override { return num_updates_; }
+
   /// Return the number of fourier-space vectors
   int num_vectors() const { return static_cast<int>(wave_prefactor_.size()); }
 
@@ -244,9 +266,12 @@ class Ewald : public VisitModel {
   std::vector<double> struct_fact_imag_new_;
   // temporary
   double stored_energy_new_ = 0.;
+  std::vector<double> struct_fact_real_base_;
+  std::vector<double> struct_fact_imag_base_;
 
   // temporary
   bool finalizable_ = false;
+  int64_t num_updates_ = 0;
 
   /// Return the sum of the squared charge.
   double sum_squared_charge_(const Configuration& config) {
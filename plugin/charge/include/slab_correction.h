@@ -65,6 +65,7 @@ class SlabCorrection : public VisitModel {
       const int group_index) override;
 
   void finalize(const Select& select, Configuration * config) override;
+  bool is_synchronize_complete() const override { return false; }
 
   std::shared_ptr<VisitModel> create(std::istream& istr) const override {
     return std::make_shared<SlabCorrection>(istr); }
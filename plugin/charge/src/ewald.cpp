@@ -504,6 +504,7 @@ void Ewald::compute(
   std::fill(struct_fact_real_new_.begin(), struct_fact_real_new_.end(), 0.);
   std::fill(struct_fact_imag_new_.begin(), struct_fact_imag_new_.end(), 0.);
   resize_eik_(*config);
+  ++num_updates_;
   update_struct_fact_eik(config->group_select(group_index), *config,
                          &struct_fact_real_new_,
                          &struct_fact_imag_new_,
@@ -542,6 +543,7 @@ void Ewald::compute(
     struct_fact_imag_new_ = struct_fact_imag();
   }
   resize_eik_(*config);
+  ++num_updates_;
   update_struct_fact_eik(selection, *config, &struct_fact_real_new_,
                                              &struct_fact_imag_new_,
                                              &eik_new_);
@@ -571,6 +573,38 @@ void Ewald::compute(
   finalizable_ = true;
 }
 
+void Ewald::compute_candidates(
+    Model * model,
+    const ModelParams& model_params,
+    const Select& selection,
+    const std::vector<std::vector<Position> >& candidates,
+    Configuration * config,
+    const int group_index,
+    std::vector<double> * energies) {
+  const bool is_move = selection.trial_state() == 1;
+  if (is_move) {
+    struct_fact_real_base_ = struct_fact_real_new_;
+    struct_fact_imag_base_ = struct_fact_imag_new_;
+  }
+  energies->resize(candidates.size());
+  store_candidates_(selection, *config);
+  for (int index = 0; index < static_cast<int>(candidates.size()); ++index) {
+    load_candidate_(candidates[index], config);
+    if (is_move) {
+      struct_fact_real_new_ = struct_fact_real_base_;
+      struct_fact_imag_new_ = struct_fact_imag_base_;
+    }
+    (*energies)[index] = model->compute(model_params, selection, group_index,
+                                        config, this);
+  }
+  restore_candidates_(config);
+  if (is_move) {
+    struct_fact_real_new_ = struct_fact_real_base_;
+    struct_fact_imag_new_ = struct_fact_imag_base_;
+  }
+  finalizable_ = false;
+}
+
 void Ewald::finalize(const Select& select, Configuration * config) {
   VisitModel::finalize(select, config);
   if (finalizable_) {
@@ -110,6 +110,49 @@ TEST(Ewald, revert) {
   EXPECT_NEAR(en, system.energy(), 1e-10);
 }
 
+TEST(Ewald, compute_candidates) {
+  System system = spce({{"alpha", str(5.6/20)}, {"kmax_squared", "27"},
+    {"xyz_file", "../plugin/configuration/test/data/spce_sample_config_periodic1.xyz"}});
+  system.energy();
+  Configuration * config = system.get_configuration();
+  Potential * ewald = system.get_potential(0);
+  const int part = 3;
+  Select select(part, config->select_particle(part));
+  Position trajectory;
+  RandomMT19937 random(argtype({{"seed", "123"}}));
+  std::vector<std::vector<Position> > candidates;
+  for (int cand = 0; cand < 4; ++cand) {
+    random.position_in_cube(3, 2., &trajectory);
+    std::vector<Position> candidate;
+    for (int site = 0; site < select.num_sites(0); ++site) {
+      Position position = config->select_particle(part).site(site).position();
+      position.add(trajectory);
+      candidate.push_back(position);
+    }
+    candidates.push_back(candidate);
+  }
+  select.set_trial_state(0);
+  ewald->select_energy(select, config);
+  select.set_trial_state(1);
+  std::vector<double> energies;
+  ewald->select_energies(select, candidates, config, &energies);
+  for (int cand = 0; cand < 4; ++cand) {
+    Select moved(select);
+    moved.load_positions(config->particles());
+    moved.set_trial_state(0);
+    ewald->select_energy(moved, config);
+    for (int site = 0; site < moved.num_sites(0); ++site) {
+      moved.set_site_position(0, site, candidates[cand][site]);
+    }
+    config->update_positions(moved, true);
+    moved.set_trial_state(1);
+    EXPECT_NEAR(energies[cand], ewald->select_energy(moved, config), 1e-8);
+    ewald->revert(moved);
+    select.set_trial_state(0);
+    config->update_positions(select, true);
+  }
+}
+
 TEST(Ewald, change_volume) {
   System system = spce({{"alpha", str(5.6/20)}, {"kmax_squared", "38"}});
   try {
@@ -45,6 +45,7 @@ class EnergyMapAll : public EnergyMap {
     const int new_map = 0) const override;
   void check(const Configuration& config) const override;
   void synchronize_(const EnergyMap& map, const Select& perturbed) override;
+  bool is_synchronize_complete() const override { return true; }
 
   // serialization
   std::string class_name() const override { return class_name_; }
@@ -515,6 +515,9 @@ class Configuration {
   //@}
 
   // HWH updates entire particle. Optimize by updating per site.
+  // Only positions and properties are copied. The cells of each site are not,
+  // so that a subsequent finalize, as in the change log of Prefetch, still
+  // moves the site out of its previous cell.
   void synchronize_(const Configuration& config, const Select& perturbed);
 
   /// Serialize
@@ -12,6 +12,7 @@ namespace feasst {
   Accumulate \f$\langle e^{-\beta \Delta U}\rangle\f$,
   where \f$\Delta U\f$ is the energy contribution of the attempt to add the
   particle.
+  See WidomInsertion for batched test insertions without the Trial machinery.
  */
 class HenryCoefficient : public Analyze {
  public:
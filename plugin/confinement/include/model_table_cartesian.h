@@ -259,6 +259,109 @@ inline std::shared_ptr<ModelTableCart3DIntegr> MakeModelTableCart3DIntegr(
   return std::make_shared<ModelTableCart3DIntegr>(args);
 }
 
+/**
+  A tabular potential for a rigid framework (or any fixed particles) based on
+  cartesian coordinates.
+  Unlike ModelTableCart3DIntegr, no symmetry is assumed and the table spans
+  the entire periodic Domain, which must have no tilt.
+  The first and last bins in each dimension are the same periodic image.
+  Each fluid site type has its own table, which is generated by sampling the
+  energy of a probe site with the framework on each grid point.
+  Site types without a table, such as those of the framework, have zero
+  energy.
+  Once generated, the framework contributes an interpolation per site instead
+  of a loop over framework sites.
+  The framework particles should then be excluded from the remaining
+  potentials by use of groups (e.g., the Potential argument group).
+ */
+class ModelTableCart3DPeriodic : public ModelOneBody {
+ public:
+  /// Constructor for a single table of site type 0.
+  explicit ModelTableCart3DPeriodic(std::shared_ptr<Table3D> table);
+
+  /// Constructor for multiple tables, one for each of the given site types.
+  ModelTableCart3DPeriodic(std::vector<std::shared_ptr<Table3D> > tables,
+    const std::vector<int> site_types);
+
+  /**
+    Constructor for text interface.
+
+    args:
+    - file_name: file name for the table, in the format described in
+      ModelTableCart3DIntegr.
+   */
+  explicit ModelTableCart3DPeriodic(argtype args = argtype());
+  explicit ModelTableCart3DPeriodic(argtype * args);
+
+  /// Return the number of tables.
+  int num_tables() const { return static_cast<int>(tables_.size()); }
+
+  /// Return the table for a given site type.
+  const Table3D& table(const int site_type = 0) const;
+
+  /**
+    Generate the table for the site type of the select by placing it on each
+    grid point and computing the energy with the rest of the system.
+    The select is assumed to be a single site.
+    Potentials of the system should only include the framework-fluid
+    interactions, e.g., by restricting them to the framework group.
+   */
+  void compute_table(System * system, Select * select);
+
+  /// Same as above, but parallelize the task with OMP.
+  void compute_table_omp(System * system, Select * select,
+    /// See Thread for documentation of these two arguments.
+    const int node = 0,
+    const int num_node = 1);
+
+  void precompute(const ModelParams& existing) override;
+
+  double energy(
+    const Position& wrapped_site,
+    const Site& site,
+    const Configuration& config,
+    const ModelParams& model_params) override;
+
+  void write(const std::string file_name) const;
+  void read(const std::string file_name);
+
+  void serialize(std::ostream& ostr) const override;
+  std::shared_ptr<Model> create(std::istream& istr) const override {
+    return std::make_shared<ModelTableCart3DPeriodic>(istr); }
+  std::shared_ptr<Model> create(argtype * args) const override {
+    return std::make_shared<ModelTableCart3DPeriodic>(args); }
+  explicit ModelTableCart3DPeriodic(std::istream& istr);
+  virtual ~ModelTableCart3DPeriodic() {}
+
+ private:
+  std::vector<std::shared_ptr<Table3D> > tables_;
+  std::vector<int> site_types_;
+
+  // temporary and not serialized
+  std::vector<int> type_to_table_;
+
+  int table_index_(const int site_type) const;
+  void set_grid_point_(const Table3D& table, const int bin0, const int bin1,
+    const int bin2, const Domain& domain, Position * point) const;
+  void copy_periodic_images_(Table3D * table) const;
+};
+
+inline std::shared_ptr<ModelTableCart3DPeriodic> MakeModelTableCart3DPeriodic(
+    std::shared_ptr<Table3D> table) {
+  return std::make_shared<ModelTableCart3DPeriodic>(table);
+}
+
+inline std::shared_ptr<ModelTableCart3DPeriodic> MakeModelTableCart3DPeriodic(
+    std::vector<std::shared_ptr<Table3D> > tables,
+    const std::vector<int> site_types) {
+  return std::make_shared<ModelTableCart3DPeriodic>(tables, site_types);
+}
+
+inline std::shared_ptr<ModelTableCart3DPeriodic> MakeModelTableCart3DPeriodic(
+    argtype args = argtype()) {
+  return std::make_shared<ModelTableCart3DPeriodic>(args);
+}
+
 }  // namespace feasst
 
 #endif  // FEASST_CONFINEMENT_MODEL_TABLE_CARTESIAN_H_
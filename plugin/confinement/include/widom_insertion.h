@@ -0,0 +1,120 @@
+#ifndef FEASST_CONFINEMENT_WIDOM_INSERTION_H_
+#define FEASST_CONFINEMENT_WIDOM_INSERTION_H_
+
+#include <memory>
+#include <vector>
+#include "math/include/random_mt19937.h"
+#include "monte_carlo/include/analyze.h"
+
+namespace feasst {
+
+class System;
+
+/**
+  Accumulate \f$\langle e^{-\beta \Delta U}\rangle\f$ of test insertions of
+  a rigid particle, where \f$\Delta U\f$ is the energy contribution of the
+  inserted particle.
+  The average is the Henry coefficient of a particle in an otherwise empty
+  pore, and \f$-\ln\langle e^{-\beta \Delta U}\rangle\f$ is the excess
+  chemical potential, \f$\beta\mu_{ex}\f$, of the Widom insertion method in
+  a bulk fluid.
+
+  Unlike HenryCoefficient, the test insertions do not use the Trial
+  machinery, and do not require AlwaysReject.
+  Instead, each update draws a number of uniformly random positions and
+  orientations, in batches, and each batch is evaluated at once with
+  Potential::select_energies, which reuses the cell list neighbors for all
+  positions in a batch with VisitModelCell.
+  Batches are distributed among OpenMP threads, and each thread inserts
+  into its own copy of the System, with its own random number generator.
+  The copies are kept between updates.
+  If the particles and volume are unchanged since the previous update, and
+  the System::is_synchronize_complete, only the positions are updated.
+  Otherwise, the System is copied again.
+  The Accumulator is given the average of each batch, and its block averages
+  provide the statistical error.
+  The results are reproducible for a given seed and number of threads,
+  including restarts from a checkpoint.
+ */
+class WidomInsertion : public Analyze {
+ public:
+  //@{
+  /** @name Arguments
+    - particle_type: type of particle to insert (default: 0).
+    - num_insertions: number of test insertions per update (default: 1000).
+    - batch_size: number of test insertions evaluated at once
+      (default: 100).
+    - num_threads: number of OpenMP threads (default: 1).
+    - Stepper arguments.
+    - RandomMT19937 arguments.
+   */
+  explicit WidomInsertion(argtype args = argtype());
+  explicit WidomInsertion(argtype * args);
+
+  //@}
+  /** @name Public Functions
+   */
+  //@{
+
+  /// Return the accumulated average of the Boltzmann factor.
+  const Accumulator& boltzmann_factor() const { return accumulator(); }
+
+  /// Return the excess chemical potential, \f$\beta\mu_{ex}\f$.
+  double beta_mu_excess() const;
+
+  std::string header(const Criteria& criteria,
+    const System& system,
+    const TrialFactory& trials) const override;
+
+  void initialize(Criteria * criteria,
+      System * system,
+      TrialFactory * trial_factory) override;
+
+  void update(const Criteria& criteria,
+      const System& system,
+      const TrialFactory& trial_factory) override;
+
+  std::string write(const Criteria& criteria,
+      const System& system,
+      const TrialFactory& trial_factory) override;
+
+  // serialize
+  std::string class_name() const override {
+    return std::string("WidomInsertion"); }
+  std::shared_ptr<Analyze> create(std::istream& istr) const override {
+    return std::make_shared<WidomInsertion>(istr); }
+  std::shared_ptr<Analyze> create(argtype * args) const override {
+    return std::make_shared<WidomInsertion>(args); }
+  void serialize(std::ostream& ostr) const override;
+  explicit WidomInsertion(std::istream& istr);
+  virtual ~WidomInsertion() {}
+
+  //@}
+ private:
+  int particle_type_;
+  int num_insertions_;
+  int batch_size_;
+  int num_threads_;
+  RandomMT19937 random_;
+  std::vector<RandomMT19937> thread_random_;
+
+  // temporary and not serialized
+  std::vector<std::shared_ptr<System> > thread_system_;
+  std::vector<double> batch_average_;
+
+  // Update the copy of the System for a thread.
+  void update_thread_system_(const System& system, const int thread);
+
+  // Return the average Boltzmann factor of a batch of insertions.
+  double batch_(const int num, const double beta, System * system,
+                Random * random) const;
+};
+
+inline std::shared_ptr<WidomInsertion> MakeWidomInsertion(
+    argtype args = argtype()) {
+  return std::make_shared<WidomInsertion>(args);
+}
+
+}  // namespace feasst
+
+#endif  // FEASST_CONFINEMENT_WIDOM_INSERTION_H_
@@ -264,6 +264,52 @@ void ModelTableCart2DIntegr::compute_table_omp(
   #endif // _OPENMP
 }
 
+// Read the table file format described in ModelTableCart3DIntegr.
+static void read_table_file_(const std::string& file_name,
+    std::vector<std::shared_ptr<Table3D> > * tables,
+    std::vector<int> * site_types) {
+  std::ifstream file(file_name);
+  ASSERT(file.good(), "cannot find " << file_name);
+  std::string descript, line;
+  int int_val;
+  file >> descript >> int_val;
+  ASSERT(descript == "site_types", "format error: " << descript);
+  const int num_sites = int_val;
+  DEBUG("num_sites " << num_sites);
+  site_types->resize(num_sites);
+  for (int type = 0; type < num_sites; ++type) {
+    file >> int_val;
+    DEBUG("site " << int_val);
+    (*site_types)[type] = int_val;
+  }
+  std::getline(file, line);
+  Table3D empty;
+  for (int type = 0; type < num_sites; ++type) {
+    std::getline(file, line);
+    tables->push_back(std::make_shared<Table3D>(empty.deserialize(line)));
+  }
+  tables->resize(num_sites);
+}
+
+static void write_table_file_(const std::string& file_name,
+    const std::vector<std::shared_ptr<Table3D> >& tables,
+    const std::vector<int>& site_types) {
+  std::ofstream file(file_name);
+  const int num_site_types = static_cast<int>(site_types.size());
+  if (num_site_types != 0) {
+    file << "site_types " << num_site_types << " ";
+    for (int site : site_types) {
+      file << site << " ";
+    }
+  } else {
+    file << "site_types 1 0";
+  }
+  file << std::endl;
+  for (std::shared_ptr<Table3D> table : tables) {
+    file << table->serialize() << std::endl;
+  }
+}
+
 class MapModelTableCart3DIntegr {
  public:
   MapModelTableCart3DIntegr() {
@@ -323,44 +369,11 @@ ModelTableCart3DIntegr::ModelTableCart3DIntegr(argtype args) : ModelTableCart3DI
 }
 
 void ModelTableCart3DIntegr::read(const std::string file_name) {
-  std::ifstream file(file_name);
-  ASSERT(file.good(), "cannot find " << file_name);
-  std::string descript, line;
-  int int_val;
-  file >> descript >> int_val;
-  ASSERT(descript == "site_types", "format error: " << descript);
-  const int num_sites = int_val;
-  DEBUG("num_sites " << num_sites);
-  site_types_.resize(num_sites);
-  for (int type = 0; type < num_sites; ++type) {
-    file >> int_val;
-    DEBUG("site " << int_val);
-    site_types_[type] = int_val;
-  }
-  std::getline(file, line);
-  Table3D empty;
-  for (int type = 0; type < num_sites; ++type) {
-    std::getline(file, line);
-    tables_.push_back(std::make_shared<Table3D>(empty.deserialize(line)));
-  }
-  tables_.resize(num_sites);
+  read_table_file_(file_name, &tables_, &site_types_);
 }
 
 void ModelTableCart3DIntegr::write(const std::string file_name) const {
-  std::ofstream file(file_name);
-  const int num_site_types = static_cast<int>(site_types_.size());
-  if (num_site_types != 0) {
-    file << "site_types " << num_site_types << " ";
-    for (int site : site_types_) {
-      file << site << " ";
-    }
-  } else {
-    file << "site_types 1 0";
-  }
-  file << std::endl;
-  for (std::shared_ptr<Table3D> table : tables_) {
-    file << table->serialize() << std::endl;
-  }
+  write_table_file_(file_name, tables_, site_types_);
 }
 
 void ModelTableCart3DIntegr::serialize(std::ostream& ostr) const {
@@ -615,4 +628,236 @@ void ModelTableCart3DIntegr::compute_table_omp(
   #endif // _OPENMP
 }
 
+class MapModelTableCart3DPeriodic {
+ public:
+  MapModelTableCart3DPeriodic() {
+    auto model = MakeModelTableCart3DPeriodic(MakeTable3D());
+    model->deserialize_map()["ModelTableCart3DPeriodic"] = model;
+  }
+};
+
+static MapModelTableCart3DPeriodic map_model_table_cart3d_periodic_ =
+  MapModelTableCart3DPeriodic();
+
+ModelTableCart3DPeriodic::ModelTableCart3DPeriodic(
+    std::shared_ptr<Table3D> table)
+  : ModelTableCart3DPeriodic({table}, {0}) {}
+
+ModelTableCart3DPeriodic::ModelTableCart3DPeriodic(
+    std::vector<std::shared_ptr<Table3D> > tables,
+    const std::vector<int> site_types) {
+  class_name_ = "ModelTableCart3DPeriodic";
+  ASSERT(tables.size() == site_types.size(), "size mismatch of tables: "
+    << tables.size() << " and site_types: " << site_types.size());
+  tables_ = tables;
+  site_types_ = site_types;
+}
+
+ModelTableCart3DPeriodic::ModelTableCart3DPeriodic(argtype * args) {
+  class_name_ = "ModelTableCart3DPeriodic";
+  read(str("file_name", args));
+}
+ModelTableCart3DPeriodic::ModelTableCart3DPeriodic(argtype args)
+  : ModelTableCart3DPeriodic(&args) {
+  FEASST_CHECK_ALL_USED(args);
+}
+
+void ModelTableCart3DPeriodic::read(const std::string file_name) {
+  tables_.clear();
+  site_types_.clear();
+  read_table_file_(file_name, &tables_, &site_types_);
+}
+
+void ModelTableCart3DPeriodic::write(const std::string file_name) const {
+  write_table_file_(file_name, tables_, site_types_);
+}
+
+void ModelTableCart3DPeriodic::serialize(std::ostream& ostr) const {
+  ostr << class_name_ << " ";
+  serialize_model_(ostr);
+  feasst_serialize_version(3172, ostr);
+  feasst_serialize(tables_, ostr);
+  feasst_serialize(site_types_, ostr);
+}
+
+ModelTableCart3DPeriodic::ModelTableCart3DPeriodic(std::istream& istr)
+  : ModelOneBody(istr) {
+  const int version = feasst_deserialize_version(istr);
+  ASSERT(version == 3172, "unrecognized verison: " << version);
+  int dim1;
+  istr >> dim1;
+  tables_.resize(dim1);
+  for (int index = 0; index < dim1; ++index) {
+    int existing;
+    istr >> existing;
+    if (existing != 0) {
+      tables_[index] = std::make_shared<Table3D>(istr);
+    }
+  }
+  feasst_deserialize(&site_types_, istr);
+}
+
+void ModelTableCart3DPeriodic::precompute(const ModelParams& existing) {
+  Model::precompute(existing);
+  type_to_table_.assign(existing.size(), -1);
+  for (int index = 0; index < static_cast<int>(site_types_.size()); ++index) {
+    const int type = site_types_[index];
+    ASSERT(type < static_cast<int>(type_to_table_.size()),
+      "site type: " << type << " in table is not in Configuration");
+    type_to_table_[type] = index;
+  }
+}
+
+int ModelTableCart3DPeriodic::table_index_(const int site_type) const {
+  int index = -1;
+  find_in_list(site_type, site_types_, &index);
+  ASSERT(index != -1, "no table for site type: " << site_type);
+  return index;
+}
+
+const Table3D& ModelTableCart3DPeriodic::table(const int site_type) const {
+  return const_cast<Table3D&>(*tables_[table_index_(site_type)]);
+}
+
+double ModelTableCart3DPeriodic::energy(
+    const Position& wrapped_site,
+    const Site& site,
+    const Configuration& config,
+    const ModelParams& model_params) {
+  ASSERT(site.type() < static_cast<int>(type_to_table_.size()),
+    "precompute required");
+  const int index = type_to_table_[site.type()];
+  if (index == -1) {
+    return 0.;
+  }
+  const std::vector<double>& sides = config.domain().side_lengths().coord();
+  double val[3];
+  for (int dim = 0; dim < 3; ++dim) {
+    val[dim] = wrapped_site.coord(dim)/sides[dim] + 0.5;
+    if (val[dim] < 0.) {
+      val[dim] = 0.;
+    } else if (val[dim] > 1.) {
+      val[dim] = 1.;
+    }
+  }
+  return tables_[index]->linear_interpolation(val[0], val[1], val[2]);
+}
+
+void ModelTableCart3DPeriodic::set_grid_point_(const Table3D& table,
+    const int bin0, const int bin1, const int bin2, const Domain& domain,
+    Position * point) const {
+  point->set_coord(0, (table.bin_to_value(0, bin0) - 0.5)*domain.side_length(0));
+  point->set_coord(1, (table.bin_to_value(1, bin1) - 0.5)*domain.side_length(1));
+  point->set_coord(2, (table.bin_to_value(2, bin2) - 0.5)*domain.side_length(2));
+}
+
+void ModelTableCart3DPeriodic::copy_periodic_images_(Table3D * table) const {
+  const int n0 = table->num0(), n1 = table->num1(), n2 = table->num2();
+  for (int bin0 = 0; bin0 < n0; ++bin0) {
+    for (int bin1 = 0; bin1 < n1; ++bin1) {
+      table->set_data(bin0, bin1, n2 - 1, table->data()[bin0][bin1][0]);
+    }
+  }
+  for (int bin0 = 0; bin0 < n0; ++bin0) {
+    for (int bin2 = 0; bin2 < n2; ++bin2) {
+      table->set_data(bin0, n1 - 1, bin2, table->data()[bin0][0][bin2]);
+    }
+  }
+  for (int bin1 = 0; bin1 < n1; ++bin1) {
+    for (int bin2 = 0; bin2 < n2; ++bin2) {
+      table->set_data(n0 - 1, bin1, bin2, table->data()[0][bin1][bin2]);
+    }
+  }
+}
+
+void ModelTableCart3DPeriodic::compute_table(System * system, Select * select) {
+  ASSERT(select->num_sites() == 1, "assumes a single site");
+  const Configuration& config = system->configuration();
+  const int site_type = config.select_particle(select->particle_index(0)).site(
+    select->site_index(0, 0)).type();
+  Table3D * table = tables_[table_index_(site_type)].get();
+  ASSERT(table->num0() > 1 && table->num1() > 1 && table->num2() > 1,
+    "periodic tables require at least two bins in each dimension");
+  const int total = (table->num0() - 1)*(table->num1() - 1)*(table->num2() - 1);
+  auto report = MakeProgressReport({{"num", str(total)}});
+
+  // MC machinery
+  TrialSelect tsel;
+  tsel.set_mobile(*select);
+  PerturbAnywhere perturb;
+  perturb.precompute(&tsel, system);
+
+  const Domain& domain = config.domain();
+  Position point(domain.dimension());
+  for (int bin0 = 0; bin0 < table->num0() - 1; ++bin0) {
+    for (int bin1 = 0; bin1 < table->num1() - 1; ++bin1) {
+      for (int bin2 = 0; bin2 < table->num2() - 1; ++bin2) {
+        set_grid_point_(*table, bin0, bin1, bin2, domain, &point);
+        perturb.set_position(point, system, &tsel);
+        system->energy(0);
+        table->set_data(bin0, bin1, bin2, system->perturbed_energy(*select, 0));
+        perturb.finalize(system);
+        system->finalize(*select);
+        report->check();
+      }
+    }
+  }
+  copy_periodic_images_(table);
+}
+
+void ModelTableCart3DPeriodic::compute_table_omp(
+    System * system,
+    Select * select,
+    const int node,
+    const int num_nodes) {
+  #ifdef _OPENMP
+  ASSERT(select->num_sites() == 1, "assumes a single site");
+  const int site_type = system->configuration().select_particle(
+    select->particle_index(0)).site(select->site_index(0, 0)).type();
+  Table3D * table = tables_[table_index_(site_type)].get();
+  ASSERT(table->num0() > 1 && table->num1() > 1 && table->num2() > 1,
+    "periodic tables require at least two bins in each dimension");
+  #pragma omp parallel
+  {
+    System system_t = deep_copy(*system);
+    Select select_t = deep_copy(*select);
+
+    // MC machinery
+    TrialSelect tsel;
+    tsel.precompute(&system_t);
+    tsel.set_mobile(select_t);
+    PerturbAnywhere perturb;
+    perturb.precompute(&tsel, &system_t);
+
+    auto thread = MakeThreadOMP();
+    int iteration = 0;
+    const int total =
+      (table->num0() - 1)*(table->num1() - 1)*(table->num2() - 1);
+    auto report = MakeProgressReport({{"num", str(total/thread->num()/num_nodes)}});
+    const Domain& domain = system_t.configuration().domain();
+    Position point(domain.dimension());
+    for (int bin0 = 0; bin0 < table->num0() - 1; ++bin0) {
+    for (int bin1 = 0; bin1 < table->num1() - 1; ++bin1) {
+    for (int bin2 = 0; bin2 < table->num2() - 1; ++bin2) {
+      if (thread->in_chunk(iteration, total, node, num_nodes)) {
+        set_grid_point_(*table, bin0, bin1, bin2, domain, &point);
+        perturb.set_position(point, &system_t, &tsel);
+        perturb.set_finalize_possible(true, &tsel);
+        system_t.energy(0);
+        table->set_data(bin0, bin1, bin2,
+          system_t.perturbed_energy(select_t, 0));
+        perturb.finalize(&system_t);
+        system_t.finalize(select_t);
+        report->check();
+      }
+      ++iteration;
+    }}}
+  }
+  copy_periodic_images_(table);
+  #else // _OPENMP
+    WARN("OMP not detected");
+    compute_table(system, select);
+  #endif // _OPENMP
+}
+
 }  // namespace feasst
@@ -0,0 +1,208 @@
+#ifdef _OPENMP
+  #include <omp.h>
+#endif // _OPENMP
+#include <cmath>
+#include <sstream>
+#include "utils/include/serialize.h"
+#include "math/include/matrix.h"
+#include "configuration/include/domain.h"
+#include "configuration/include/select.h"
+#include "configuration/include/configuration.h"
+#include "system/include/system.h"
+#include "confinement/include/widom_insertion.h"
+
+namespace feasst {
+
+class MapWidomInsertion {
+ public:
+  MapWidomInsertion() {
+    auto obj = MakeWidomInsertion();
+    obj->deserialize_map()["WidomInsertion"] = obj;
+  }
+};
+
+static MapWidomInsertion mapper_ = MapWidomInsertion();
+
+WidomInsertion::WidomInsertion(argtype * args) : Analyze(args) {
+  particle_type_ = integer("particle_type", args, 0);
+  num_insertions_ = integer("num_insertions", args, 1000);
+  batch_size_ = integer("batch_size", args, 100);
+  num_threads_ = integer("num_threads", args, 1);
+  ASSERT(batch_size_ > 0, "batch_size: " << batch_size_ << " must be > 0");
+  ASSERT(num_insertions_ % batch_size_ == 0, "num_insertions: "
+    << num_insertions_ << " must be a multiple of batch_size: "
+    << batch_size_);
+  ASSERT(num_threads_ > 0, "num_threads: " << num_threads_);
+  #ifndef _OPENMP
+    ASSERT(num_threads_ == 1, "num_threads > 1 requires OpenMP");
+  #endif // _OPENMP
+  random_ = RandomMT19937(args);
+}
+WidomInsertion::WidomInsertion(argtype args) : WidomInsertion(&args) {
+  FEASST_CHECK_ALL_USED(args);
+}
+
+double WidomInsertion::beta_mu_excess() const {
+  return -std::log(accumulator().average());
+}
+
+void WidomInsertion::initialize(Criteria * criteria,
+    System * system,
+    TrialFactory * trial_factory) {
+  ASSERT(particle_type_ < system->configuration().num_particle_types(),
+    "particle_type: " << particle_type_ << " is not in Configuration");
+  printer(header(*criteria, *system, *trial_factory),
+          file_name(*criteria));
+}
+
+std::string WidomInsertion::header(const Criteria& criteria,
+    const System& system,
+    const TrialFactory& trial_factory) const {
+  std::stringstream ss;
+  ss << "beta_mu_excess," << accumulator_.status_header() << std::endl;
+  return ss.str();
+}
+
+double WidomInsertion::batch_(const int num, const double beta,
+    System * system, Random * random) const {
+  Configuration * config = system->get_configuration();
+  config->add_particle_of_type(particle_type_);
+  Select select(config->newest_particle_index(), config->newest_particle());
+  select.set_trial_state(3);
+  const int num_sites = select.num_sites();
+  const int dimension = config->dimension();
+  const Domain& domain = config->domain();
+  const Particle& particle = config->newest_particle();
+  std::vector<Position> relative(num_sites);
+  for (int site = 0; site < num_sites; ++site) {
+    relative[site] = particle.site(site).position();
+    relative[site].subtract(particle.site(0).position());
+  }
+  std::vector<std::vector<Position> > candidates(num,
+    std::vector<Position>(num_sites));
+  Position origin, axis;
+  RotationMatrix rotation;
+  for (std::vector<Position>& candidate : candidates) {
+    domain.random_position(&origin, random);
+    if (num_sites > 1) {
+      random->rotation(dimension, &axis, &rotation);
+    }
+    for (int site = 0; site < num_sites; ++site) {
+      candidate[site] = origin;
+      candidate[site].add(relative[site]);
+      if (num_sites > 1) {
+        rotation.rotate(origin, &candidate[site]);
+      }
+    }
+  }
+  std::vector<double> energies;
+  system->perturbed_energies(select, candidates, &energies);
+  config->remove_particle(select);
+  double sum = 0.;
+  for (const double energy : energies) {
+    sum += std::exp(-beta*energy);
+  }
+  return sum/static_cast<double>(num);
+}
+
+void WidomInsertion::update_thread_system_(const System& system,
+    const int thread) {
+  std::shared_ptr<System> * copy = &thread_system_[thread];
+  if (*copy) {
+    const Configuration& config = system.configuration();
+    const Configuration& copy_config = (*copy)->configuration();
+    bool is_same = (*copy)->is_synchronize_complete() &&
+      std::abs(config.domain().volume() -
+               copy_config.domain().volume()) < NEAR_ZERO &&
+      config.selection_of_all().particle_indices() ==
+      copy_config.selection_of_all().particle_indices();
+    for (int type = 0; is_same && type < config.num_particle_types(); ++type) {
+      is_same = config.num_particles_of_type(type) ==
+                copy_config.num_particles_of_type(type);
+    }
+    if (is_same) {
+      Select all(config.selection_of_all());
+      all.set_trial_state(1);
+      (*copy)->synchronize_(system, all);
+      (*copy)->finalize(all);
+      return;
+    }
+  }
+  std::stringstream ss;
+  system.serialize(ss);
+  *copy = std::make_shared<System>(ss);
+}
+
+void WidomInsertion::update(const Criteria& criteria,
+    const System& system,
+    const TrialFactory& trial_factory) {
+  if (static_cast<int>(thread_random_.size()) != num_threads_) {
+    thread_random_.clear();
+    for (int thread = 0; thread < num_threads_; ++thread) {
+      thread_random_.push_back(RandomMT19937({{"seed",
+        str(random_.uniform(1, 2147483646))}}));
+    }
+  }
+  thread_system_.resize(num_threads_);
+  const double beta = system.thermo_params().beta();
+  const int num_batches = num_insertions_/batch_size_;
+  batch_average_.resize(num_batches);
+  #ifdef _OPENMP
+  #pragma omp parallel num_threads(num_threads_)
+  {
+    const int thread = omp_get_thread_num();
+  #else // _OPENMP
+  {
+    const int thread = 0;
+  #endif // _OPENMP
+    update_thread_system_(system, thread);
+    System * thread_system = thread_system_[thread].get();
+    Random * random = &thread_random_[thread];
+    #ifdef _OPENMP
+    #pragma omp for schedule(static)
+    #endif // _OPENMP
+    for (int batch = 0; batch < num_batches; ++batch) {
+      batch_average_[batch] = batch_(batch_size_, beta, thread_system,
+                                     random);
+    }
+  }
+  for (const double average : batch_average_) {
+    accumulator_.accumulate(average);
+  }
+}
+
+std::string WidomInsertion::write(const Criteria& criteria,
+    const System& system,
+    const TrialFactory& trial_factory) {
+  std::stringstream ss;
+  ss << MAX_PRECISION << beta_mu_excess() << "," << accumulator_.status()
+     << std::endl;
+  DEBUG(ss.str());
+  return ss.str();
+}
+
+void WidomInsertion::serialize(std::ostream& ostr) const {
+  Stepper::serialize(ostr);
+  feasst_serialize_version(4717, ostr);
+  feasst_serialize(particle_type_, ostr);
+  feasst_serialize(num_insertions_, ostr);
+  feasst_serialize(batch_size_, ostr);
+  feasst_serialize(num_threads_, ostr);
+  feasst_serialize_fstobj(random_, ostr);
+  feasst_serialize_fstobj(thread_random_, ostr);
+}
+
+WidomInsertion::WidomInsertion(std::istream& istr) : Analyze(istr) {
+  const int version = feasst_deserialize_version(istr);
+  ASSERT(version >= 4716 && version <= 4717, "mismatch version: " << version);
+  feasst_deserialize(&particle_type_, istr);
+  feasst_deserialize(&num_insertions_, istr);
+  feasst_deserialize(&batch_size_, istr);
+  feasst_deserialize(&num_threads_, istr);
+  feasst_deserialize_fstobj(&random_, istr);
+  if (version >= 4717) {
+    feasst_deserialize_fstobj(&thread_random_, istr);
+  }
+}
+
+}  // namespace feasst
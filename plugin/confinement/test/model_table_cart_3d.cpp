@@ -1,9 +1,12 @@
+#include <cmath>
 #include "utils/test/utils.h"
 #include "utils/include/checkpoint.h"
 #include "math/include/random_mt19937.h"
 #include "configuration/include/configuration.h"
 #include "configuration/include/select.h"
 #include "configuration/include/domain.h"
+#include "system/include/lennard_jones.h"
+#include "system/include/system.h"
 #include "shape/include/slab_sine.h"
 #include "shape/include/formula_sine_wave.h"
 #include "confinement/include/model_table_cartesian.h"
@@ -83,4 +86,72 @@ TEST(ModelTableCard1DHard, compute_table) {
   model->compute_table(shape.get(), domain.get(), random.get());
 }
 
+TEST(ModelTableCart3DPeriodic, framework) {
+  System system;
+  system.add(MakeConfiguration({{"cubic_side_length", "6"},
+    {"particle_type0", "../particle/lj.fstprt"},
+    {"particle_type1", "../particle/atom.fstprt"},
+    {"add_particles_of_type0", "3"}, {"add_particles_of_type1", "1"},
+    {"group0", "framework"}, {"framework_particle_type0", "0"}}));
+  system.get_configuration()->update_positions(
+    {{0, 0, 0}, {2.5, 0, 0}, {-1, 1.5, 2}, {1, 1, 1}});
+  system.add(MakePotential(MakeLennardJones(), {{"group", "framework"}}));
+  system.precompute();
+  const Configuration& config = system.configuration();
+  auto model = MakeModelTableCart3DPeriodic({MakeTable3D({
+    {"num0", "61"}, {"num1", "61"}, {"num2", "61"}})}, {1});
+  Select probe(3, config.particle(3));
+  model->compute_table(&system, &probe);
+  model->precompute(config.model_params());
+  EXPECT_NEAR(model->table(1).data()[0][0][0],
+              model->table(1).data()[60][60][60], NEAR_ZERO);
+  TRY(
+    model->table(0);
+    CATCH_PHRASE("no table for site type: 0");
+  );
+  EXPECT_EQ(0., model->energy(config.particle(0).site(0).position(),
+    config.particle(0).site(0), config, config.model_params()));
+
+  // compare the interpolated and explicit energies of the probe, away from
+  // the steep repulsion of the framework sites
+  const std::vector<std::vector<double> > framework =
+    {{0, 0, 0}, {2.5, 0, 0}, {-1, 1.5, 2}};
+  auto random = MakeRandomMT19937({{"seed", "123"}});
+  Position wrapped(3);
+  int num_compared = 0;
+  for (int trial = 0; trial < 100; ++trial) {
+    wrapped = random->position_in_cube(3, 6.);
+    double min_dist_sq = 100.;
+    for (const std::vector<double>& site : framework) {
+      double dist_sq = 0.;
+      for (int dim = 0; dim < 3; ++dim) {
+        double dx = wrapped.coord(dim) - site[dim];
+        dx -= 6.*std::round(dx/6.);
+        dist_sq += dx*dx;
+      }
+      min_dist_sq = std::min(min_dist_sq, dist_sq);
+    }
+    std::vector<std::vector<double> > coords = framework;
+    coords.push_back(wrapped.coord());
+    system.get_configuration()->update_positions(coords);
+    const double en = system.perturbed_energy(probe);
+    if (min_dist_sq > 1.4*1.4) {
+      const Site& site = config.particle(3).site(0);
+      EXPECT_NEAR(en, model->energy(wrapped, site, config,
+        config.model_params()), 0.05);
+      ++num_compared;
+    }
+  }
+  EXPECT_GT(num_compared, 10);
+
+  model->write("tmp/periodic_table.txt");
+  auto model2 = MakeModelTableCart3DPeriodic({
+    {"file_name", "tmp/periodic_table.txt"}});
+  EXPECT_EQ(1, model2->num_tables());
+  EXPECT_NEAR(model2->table(1).data()[3][4][5],
+              model->table(1).data()[3][4][5], 1e-8);
+  std::shared_ptr<Model> model3 = test_serialize<ModelTableCart3DPeriodic,
+    Model>(*model);
+}
+
 }  // namespace feasst
@@ -0,0 +1,95 @@
+#include <cmath>
+#include "utils/test/utils.h"
+#include "configuration/test/config_utils.h"
+#include "system/include/lennard_jones.h"
+#include "system/include/visit_model_cell.h"
+#include "system/include/system.h"
+#include "monte_carlo/include/metropolis.h"
+#include "monte_carlo/include/trial_factory.h"
+#include "confinement/include/widom_insertion.h"
+
+namespace feasst {
+
+TEST(WidomInsertion, serialize) {
+  auto widom = MakeWidomInsertion({{"num_insertions", "20"},
+                                   {"batch_size", "10"}, {"seed", "123"}});
+  auto widom2 = test_serialize<WidomInsertion, Analyze>(*widom);
+  TRY(
+    MakeWidomInsertion({{"num_insertions", "25"}, {"batch_size", "10"}});
+    CATCH_PHRASE("must be a multiple of batch_size");
+  );
+}
+
+// a cutoff of 2 allows 4 cells per side of the box of length 8.
+System widom_lj(std::shared_ptr<VisitModel> visitor) {
+  Configuration config = lj_sample4();
+  config.set_model_param("cutoff", 0, 2.);
+  System system;
+  system.add(config);
+  system.add(MakePotential(MakeLennardJones(), visitor));
+  system.set(MakeThermoParams({{"beta", "1.2"}}));
+  system.energy();
+  return system;
+}
+
+TEST(WidomInsertion, lj) {
+  Metropolis criteria;
+  TrialFactory trials;
+  {
+    System empty;
+    empty.add(MakeConfiguration({{"cubic_side_length", "8"},
+      {"particle_type0", "../particle/lj.fstprt"}}));
+    empty.add(MakePotential(MakeLennardJones()));
+    empty.set(MakeThermoParams({{"beta", "1.2"}}));
+    empty.energy();
+    auto widom = MakeWidomInsertion({{"seed", "123"}});
+    widom->update(criteria, empty, trials);
+    EXPECT_NEAR(1., widom->boltzmann_factor().average(), NEAR_ZERO);
+    EXPECT_NEAR(0., widom->beta_mu_excess(), NEAR_ZERO);
+  }
+
+  // cell lists give the same result as the basic visitor
+  System system = widom_lj(MakeVisitModel());
+  System cell_system = widom_lj(MakeVisitModelCell({{"min_length", "2"}}));
+  auto widom = MakeWidomInsertion({{"seed", "123"}});
+  auto cell_widom = MakeWidomInsertion({{"seed", "123"}});
+  for (int update = 0; update < 2; ++update) {
+    widom->update(criteria, system, trials);
+    cell_widom->update(criteria, cell_system, trials);
+  }
+  EXPECT_EQ(20, widom->boltzmann_factor().num_values());
+  EXPECT_NEAR(widom->beta_mu_excess(), cell_widom->beta_mu_excess(), 1e-10);
+  EXPECT_TRUE(std::isfinite(widom->beta_mu_excess()));
+  EXPECT_EQ(system.configuration().num_particles(), 30);
+
+  // threads sample the same average
+  auto thread_widom = MakeWidomInsertion({{"seed", "123"},
+    {"num_threads", "2"}, {"num_insertions", "2000"}});
+  thread_widom->update(criteria, cell_system, trials);
+  EXPECT_NEAR(widom->boltzmann_factor().average(),
+              thread_widom->boltzmann_factor().average(),
+              10*std::max(widom->boltzmann_factor().stdev_of_av(),
+                          thread_widom->boltzmann_factor().stdev_of_av()));
+}
+
+TEST(WidomInsertion, restart) {
+  Metropolis criteria;
+  TrialFactory trials;
+  System system = widom_lj(MakeVisitModelCell({{"min_length", "2"}}));
+  auto widom = MakeWidomInsertion({{"seed", "123"}, {"num_threads", "2"}});
+  widom->update(criteria, system, trials);
+  auto restart = test_serialize<WidomInsertion, Analyze>(*widom);
+
+  // a restart copies the System while the original synchronizes its copies
+  Select select(0, system.configuration().select_particle(0));
+  select.set_trial_state(1);
+  system.get_configuration()->displace(select, Position({0.1, 0.1, 0.1}));
+  system.finalize(select);
+  widom->update(criteria, system, trials);
+  restart->update(criteria, system, trials);
+  EXPECT_EQ(20, restart->accumulator().num_values());
+  EXPECT_NEAR(widom->boltzmann_factor().average(),
+              restart->accumulator().average(), NEAR_ZERO);
+}
+
+}  // namespace feasst
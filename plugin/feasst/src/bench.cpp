@@ -0,0 +1,247 @@
+#include <chrono>
+#include <fstream>
+#include <functional>
+#include <sstream>
+#include "utils/include/io.h"
+#include "utils/include/debug.h"
+#include "math/include/table.h"
+#include "math/include/random_mt19937.h"
+#include "configuration/include/configuration.h"
+#include "configuration/include/domain.h"
+#include "configuration/include/select.h"
+#include "system/include/lennard_jones.h"
+#include "system/include/visit_model_inner.h"
+#include "system/include/visit_model_cell.h"
+#include "system/include/potential.h"
+#include "system/include/system.h"
+
+/**
+  Microbenchmarks of the kernels which dominate the cost of a typical
+  simulation.
+  Every benchmark uses a fixed seed, so that the work is identical from one
+  commit to the next, and the checksum should only change when the results
+  of a kernel change.
+
+  Usage: ./feasst_bench [file_name.json] [scale]
+
+  The results are written in JSON to file_name.json, or to standard output by
+  default.
+  The number of iterations of each benchmark is multiplied by scale
+  (default: 1).
+ */
+
+namespace feasst {
+
+struct BenchResult {
+  std::string name;
+  int64_t iterations;
+  double seconds;
+  double checksum;
+};
+
+// Time a kernel which returns a value that is accumulated in the checksum,
+// so that the kernel is not optimized away.
+BenchResult bench(const std::string& name, const int64_t iterations,
+    std::function<double()> kernel) {
+  double checksum = 0.;
+  const auto begin = std::chrono::steady_clock::now();
+  for (int64_t iteration = 0; iteration < iterations; ++iteration) {
+    checksum += kernel();
+  }
+  const double seconds = std::chrono::duration<double>(
+    std::chrono::steady_clock::now() - begin).count();
+  return BenchResult{name, iterations, seconds, checksum};
+}
+
+std::string json(const std::vector<BenchResult>& results) {
+  std::stringstream ss;
+  ss << "{\"version\":\"" << version() << "\",\"benchmarks\":[";
+  for (int index = 0; index < static_cast<int>(results.size()); ++index) {
+    const BenchResult& result = results[index];
+    if (index != 0) ss << ",";
+    ss << std::endl << "{\"name\":\"" << result.name << "\""
+       << ",\"iterations\":" << result.iterations
+       << ",\"seconds\":" << result.seconds
+       << ",\"ns_per_iteration\":"
+       << 1e9*result.seconds/static_cast<double>(result.iterations)
+       << ",\"checksum\":" << MAX_PRECISION << result.checksum << "}";
+  }
+  ss << std::endl << "]}" << std::endl;
+  return ss.str();
+}
+
+// Return a Lennard-Jones fluid at a reduced density of 0.5.
+std::shared_ptr<Configuration> lj_fluid(const int num_particles,
+    Random * random) {
+  // The particles are added at the origin, so displace them to random positions.
+  const double length = std::pow(num_particles/0.5, 1./3.);
+  auto config = MakeConfiguration({
+    {"cubic_side_length", str(length)},
+    {"particle_type0", install_dir() + "/particle/lj.fstprt"},
+    {"add_particles_of_type0", str(num_particles)}});
+  Position position;
+  for (int part = 0; part < num_particles; ++part) {
+    Select select(part, config->select_particle(part));
+    random->position_in_cube(3, length, &position);
+    config->displace_particle(select, position);
+  }
+  return config;
+}
+
+std::vector<BenchResult> run(const int scale) {
+  std::vector<BenchResult> results;
+  RandomMT19937 random(argtype({{"seed", "1346867550"}}));
+  const int num_particles = 500;
+  std::shared_ptr<Configuration> config = lj_fluid(num_particles, &random);
+  const Domain& domain = config->domain();
+
+  // Domain::wrap_opt
+  {
+    std::vector<Position> positions;
+    for (int part = 0; part < num_particles; ++part) {
+      positions.push_back(config->select_particle(part).site(0).position());
+    }
+    Position rel, pbc;
+    double r2;
+    int index = 0;
+    results.push_back(bench("Domain::wrap_opt", 2000000*scale, [&]() {
+      index = (index + 1) % (num_particles - 1);
+      domain.wrap_opt(positions[index], positions[index + 1], &rel, &pbc, &r2);
+      return r2;
+    }));
+  }
+
+  // VisitModelInner::compute
+  {
+    LennardJones model;
+    model.precompute(config->model_params());
+    VisitModelInner inner;
+    Position rel, pbc;
+    rel.set_to_origin(3);
+    pbc.set_to_origin(3);
+    int index = 0;
+    results.push_back(bench("VisitModelInner::compute", 2000000*scale, [&]() {
+      index = (index + 1) % (num_particles - 1);
+      inner.set_energy(0.);
+      inner.compute(index, 0, index + 1, 0, config.get(),
+        config->model_params(), &model, false, &rel, &pbc);
+      return inner.energy();
+    }));
+  }
+
+  // VisitModelCell full and single-particle energies
+  System system;
+  system.add(config);
+  system.add(MakePotential(MakeLennardJones(),
+                           MakeVisitModelCell({{"min_length", "3"}})));
+  system.precompute();
+  results.push_back(bench("VisitModelCell::energy", 200*scale, [&]() {
+    return system.energy();
+  }));
+  {
+    int part = 0;
+    results.push_back(bench("VisitModelCell::select_energy", 100000*scale,
+      [&]() {
+        part = (part + 1) % num_particles;
+        const Select select(part, system.configuration().select_particle(part));
+        return system.perturbed_energy(select);
+      }));
+  }
+
+  // Cells updates
+  {
+    Configuration * sys_config = system.get_configuration();
+    Position trajectory;
+    int part = 0;
+    results.push_back(bench("Cells::update", 100000*scale, [&]() {
+      part = (part + 1) % num_particles;
+      const Select select(part, sys_config->select_particle(part));
+      random.position_in_cube(3, 1., &trajectory);
+      sys_config->displace_particle(select, trajectory);
+      system.finalize(select);
+      return sys_config->select_particle(part).site(0).cell(0);
+    }));
+  }
+
+  // Table1D/2D/3D interpolation
+  {
+    const int num = 101;
+    Table1D table1d(argtype({{"num", str(num)}}));
+    Table2D table2d(argtype({{"num0", str(num)}, {"num1", str(num)}}));
+    Table3D table3d(argtype({{"num0", str(num)}, {"num1", str(num)},
+                             {"num2", str(num)}}));
+    for (int bin0 = 0; bin0 < num; ++bin0) {
+      table1d.set_data(bin0, random.uniform());
+      for (int bin1 = 0; bin1 < num; ++bin1) {
+        table2d.set_data(bin0, bin1, random.uniform());
+        for (int bin2 = 0; bin2 < num; ++bin2) {
+          table3d.set_data(bin0, bin1, bin2, random.uniform());
+        }
+      }
+    }
+    std::vector<double> values(3000);
+    for (double& value : values) value = random.uniform();
+    int index = 0;
+    results.push_back(bench("Table1D::linear_interpolation", 2000000*scale,
+      [&]() {
+        index = (index + 1) % 2998;
+        return table1d.linear_interpolation(values[index]);
+      }));
+    results.push_back(bench("Table2D::linear_interpolation", 2000000*scale,
+      [&]() {
+        index = (index + 1) % 2998;
+        return table2d.linear_interpolation(values[index], values[index + 1]);
+      }));
+    results.push_back(bench("Table3D::linear_interpolation", 2000000*scale,
+      [&]() {
+        index = (index + 1) % 2998;
+        return table3d.linear_interpolation(values[index], values[index + 1],
+                                            values[index + 2]);
+      }));
+  }
+
+  // Random draws
+  {
+    RandomMT19937 rng(argtype({{"seed", "1346867550"}}));
+    results.push_back(bench("Random::uniform", 10000000*scale, [&]() {
+      return rng.uniform();
+    }));
+    results.push_back(bench("Random::standard_normal", 2000000*scale, [&]() {
+      return rng.standard_normal();
+    }));
+  }
+
+  // Select copying and serialization
+  {
+    const Select& all = system.configuration().group_select(0);
+    results.push_back(bench("Select::copy", 20000*scale, [&]() {
+      const Select copy(all);
+      return static_cast<double>(copy.num_sites());
+    }));
+    results.push_back(bench("Select::serialize", 2000*scale, [&]() {
+      std::stringstream ss;
+      all.serialize(ss);
+      const Select copy(ss);
+      return static_cast<double>(copy.num_sites());
+    }));
+  }
+  return results;
+}
+
+}  // namespace feasst
+
+int main(int argc, char ** argv) {
+  ASSERT(argc <= 3, "unrecognized number of arguments: " << argc);
+  int scale = 1;
+  if (argc == 3) {
+    scale = feasst::str_to_int(std::string(argv[2]));
+  }
+  const std::string results = feasst::json(feasst::run(scale));
+  if (argc >= 2) {
+    std::ofstream file(argv[1]);
+    file << results;
+  } else {
+    std::cout << results;
+  }
+  return 0;
+}
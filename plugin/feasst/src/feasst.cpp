@@ -26,7 +26,10 @@ arglist parse_mc(argtype variables = argtype()) {
 // consider moving this to CollectionMatrixSplice
 // - read arglist like in MC, but including the first line containing CollectionMatrixSplice
 // - parse arglist through CollectionMatrixSplice constructor
-void parse_cm(std::string line) {
+// If process is -1, run all windows in this process with OMP.
+// If process is -2, coordinate windows that run in other processes.
+// Otherwise, only run the window with index process.
+void parse_cm(std::string line, const int process) {
   // parse and obtain Window arguments here, as well as some additional CollectionMatrixSplice arguments.
   // use the windows to set custom variables here for soft_min and soft_max.
   // for each proc, input to bounds as variables into parse_mc to initialize clones argument
@@ -59,11 +62,47 @@ void parse_cm(std::string line) {
     "CollectionMatrixSplice must be followed with Window then Checkpoint. " <<
     "Instead, the following line was given: " << line);
   line_pair = parse_line(line, &variables, &assign_to_list);
+  std::string checkpoint_file;
+  if (process >= 0) {
+    // each window process checkpoints only its own MonteCarlo to a unique file
+    auto pair = line_pair.second.find("file_name");
+    if (pair != line_pair.second.end() && !pair->second.empty() &&
+        pair->second != " ") {
+      const std::string index = sized_int_to_str(process, window->num());
+      const size_t found = pair->second.find("[sim_index]");
+      if (found == std::string::npos) {
+        pair->second += index;
+      } else {
+        pair->second.replace(found, std::string("[sim_index]").size(), index);
+      }
+      checkpoint_file = pair->second;
+    }
+  }
   cm.set(MakeCheckpoint(line_pair.second));
 
   arglist list = parse_mc();
   std::vector<int> complete(window->num(), 0);
   cm.set_size(window->num());
+  if (process == -2) {
+    cm.coordinate();
+    return;
+  } else if (process >= 0) {
+    ASSERT(process < window->num(), "window: " << process << " >= "
+      << window->num() << " windows");
+    arglist list2 = list;
+    replace_value("[soft_macro_min]", str(window->boundaries()[process][0]), &list2);
+    replace_value("[soft_macro_max]", str(window->boundaries()[process][1]), &list2);
+    replace_in_value("[sim_index]", sized_int_to_str(process, window->num()), &list2);
+    if (!checkpoint_file.empty() && file_exists(checkpoint_file)) {
+      std::cout << "# Resuming window " << process << " from "
+                << checkpoint_file << std::endl;
+      cm.set(process, MakeMonteCarlo(checkpoint_file));
+    } else {
+      cm.set(process, std::make_shared<MonteCarlo>(list2));
+    }
+    cm.run_window(process);
+    return;
+  }
   #ifdef _OPENMP
   #pragma omp parallel
   {
@@ -94,6 +133,13 @@ void parse_cm(std::string line) {
 /**
   Usage: ./fst < file.txt
 
+  For CollectionMatrixSplice with a shared_file, windows may instead run in
+  separate processes with "./fst window INDEX < file.txt" for each window
+  INDEX, and "./fst coordinate < file.txt" to combine them.
+  Each window process writes its own Checkpoint, with "[sim_index]" in the
+  file_name replaced by INDEX (or INDEX appended, otherwise).
+  If that file exists, the window resumes from it.
+
   Syntax: MAJOR MINOR_0 VALUE_0 ... MINOR_N VALUE_N
 
   "set_variable name value" will replace any use of name in subsequent values.
@@ -101,7 +147,18 @@ void parse_cm(std::string line) {
   Any value beginning with "/feasst" will have that beginning replaced with
   feasst::install_dir().
  */
-int main() {
+int main(int argc, char ** argv) {
+  int process = -1;
+  if (argc > 1) {
+    const std::string mode(argv[1]);
+    if (mode == "coordinate") {
+      process = -2;
+    } else {
+      ASSERT(mode == "window" && argc > 2,
+        "Usage: ./fst [window INDEX | coordinate] < file.txt");
+      process = str_to_int(argv[2]);
+    }
+  }
   std::cout << "# FEASST version: " << version() << std::endl;
   std::string line;
   std::getline(std::cin, line);
@@ -119,7 +176,7 @@ int main() {
     arglist list = parse_mc();
     auto mc = std::make_shared<MonteCarlo>(list);
   } else if (line.substr(0, 22) == "CollectionMatrixSplice") {
-    parse_cm(line);
+    parse_cm(line, process);
   } else {
     FATAL("As currently implemented, all FEASST input text files must begin "
       << "with \"MonteCarlo\" or \"CollectionMatrixSplice\", but the first "
@@ -23,7 +23,7 @@ class Bias {
 
   /// Return the natural log of the bias for a transition from a macrostate
   /// in the old bin to a new bin.
-  double ln_bias(const int bin_new, const int bin_old) const {
+  virtual double ln_bias(const int bin_new, const int bin_old) const {
     return ln_prob().value(bin_old) - ln_prob().value(bin_new); }
 
   /// Update only.
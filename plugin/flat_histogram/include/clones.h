@@ -16,6 +16,7 @@ namespace feasst {
 
 class Checkpoint;
 class Histogram;
+class ExtensiveMoments;
 
 /**
   Container for initializing, running and analyzing groups of FlatHistogram
@@ -58,6 +59,15 @@ class Clones {
     - attempt_batch: perform this many attempts in a batch between checking
       for overlap (default: 1).
     - max_batch: maximum number of batches. Infinite if -1 (default: -1).
+    - pipeline: if true and OMP is available, each clone runs in its own
+      thread as soon as it is initialized, and sends its configuration to the
+      next clone when they overlap.
+      Thus, clones equilibrate in parallel while the remaining clones are
+      initialized, and initialization completes when all clones have
+      received a configuration (default: false).
+    - seed_from_any: if pipeline, an uninitialized clone may receive the
+      most recent configuration of any initialized clone of lower index that
+      overlaps, instead of only the previous clone (default: false).
    */
   void initialize(argtype args = argtype());
 
@@ -75,9 +85,35 @@ class Clones {
       write aggregate ln_prob (default: 1e6).
     - ln_prob_file: file name of aggregate ln_prob. If empty (default),
       do not write the file.
+    - swap: if true, synchronize all clones after every omp_batch and then
+      attempt a configuration swap between each pair of adjacent clones, as
+      described in attempt_swap (default: false).
+      Not implemented with initialize_and_run_until_complete.
+      With swaps, the ln_prob_file is only written when the number of
+      iterations of any clone changes, and when all clones are complete.
    */
   void run_until_complete(argtype args = argtype());
 
+  /**
+    Attempt to swap the configurations of the clones given by upper_index and
+    upper_index - 1 (e.g., replica exchange).
+    The swap is only possible if both configurations are in the overlap of
+    the two windows, and the acceptance is given by the ratio of the biases,
+    \f$\ln P_{acc} = \ln\Pi_l(m_l) - \ln\Pi_l(m_u) + \ln\Pi_u(m_u) -
+    \ln\Pi_u(m_l)\f$,
+    where \f$\Pi_l\f$ and \f$\Pi_u\f$ are the macrostate probabilities
+    (ln_prob) of the lower and upper clones, and \f$m_l\f$ and \f$m_u\f$
+    are the macrostates of the lower and upper configurations.
+    The Boltzmann factors cancel because the clones are required to have the
+    same ThermoParams.
+    If accepted, the Systems of the two clones are exchanged without a copy.
+    Return true if the swap is accepted.
+   */
+  bool attempt_swap(const int upper_index);
+
+  /// Return the acceptance of swaps between each pair of adjacent clones.
+  const std::vector<Accumulator>& swaps() const { return swaps_; }
+
   /**
     Combine the bottom up initialization and run until complete.
     With OMP, the first clone will run until finding overlap with the second.
@@ -120,6 +156,16 @@ class Clones {
       const AnalyzeData& get) const {
     ln_prob(NULL, multistate_data, analyze_name, get); }
 
+  /**
+    Return the compact ExtensiveMoments of each macrostate, spliced in the
+    same order as ln_prob.
+    In the overlap of two clones, the moments of both clones are combined
+    with ExtensiveMoments::merge.
+   */
+  std::vector<ExtensiveMoments> extensive_moments(
+    /// Name of the multistate, compact ExtensiveMoments Analyze.
+    const std::string analyze_name = "ExtensiveMoments") const;
+
   /// Serialize
   void serialize(std::ostream& ostr) const;
 
@@ -139,11 +185,15 @@ class Clones {
  private:
   std::vector<std::shared_ptr<MonteCarlo> > clones_;
   std::shared_ptr<Checkpoint> checkpoint_;
+  std::vector<Accumulator> swaps_;
 
   void run_until_complete_omp_(argtype run_args,
                                const bool init = false,
                                argtype init_args = argtype());
   void run_until_complete_serial_();
+  void initialize_pipeline_(argtype args);
+  void seed_(const int lower_index, const int upper_index);
+  void write_ln_prob_(const std::string& file_name) const;
 };
 
 /// Construct Clones
@@ -29,6 +29,16 @@ namespace feasst {
   The second is the state change as follows:
     - 0: macrostate decrease
     - 1: macrostate increase
+
+  By default, each element is an Accumulator, which updates its moments and
+  block averages for every trial.
+  In the compact mode, each element is instead a sum and a count stored in a
+  contiguous, double-banded array.
+  Block averages of each element are collected separately with a block size
+  that doubles (by merging neighboring blocks) whenever the number of blocks
+  reaches max_blocks.
+  Thus, the cost per trial and the size of a checkpoint do not depend upon
+  the length of the simulation.
  */
 class CollectionMatrix {
  public:
@@ -54,15 +64,20 @@ class CollectionMatrix {
     - exp_for_boost: ratio of neighboring probabilities must be within
       10^exp or 10^-exp for boosting.
       If -1, ignore (default: 2).
+    - compact: if true, use the compact mode described above (default: false).
+    - max_blocks: maximum number of block averages of each element in the
+      compact mode.
+      Must be an even number greater than zero (default: 32).
    */
   explicit CollectionMatrix(argtype args = argtype());
   explicit CollectionMatrix(argtype * args);
 
-  /// Construct from a matrix.
+  /// Construct from a matrix (not compact).
   explicit CollectionMatrix(
     const std::vector<std::vector<Accumulator> >& matrix);
 
-  /// Construct from a series of single-state collection matricies.
+  /// Construct from a series of single-state collection matricies
+  /// (not compact).
   explicit CollectionMatrix(
     const std::vector<std::vector<std::vector<Accumulator> > >& data);
 
@@ -71,16 +86,43 @@ class CollectionMatrix {
   /// Add value for a given macrostate and state change.
   void increment(const int macro, const int state_change, const double add);
 
-  /// Set values
+  /// Set values (not compact).
   void set(const int macro, const std::vector<Accumulator>& values);
 
+  /// Set the values of a macrostate to those of another collection matrix.
+  void set(const int macro, const CollectionMatrix& cm);
+
+  /// Set the average and number of values of a given macrostate and state
+  /// change, without block averages (compact only).
+  void set(const int macro, const int state_change, const double average,
+    const double num_values);
+
+  /// Return true if in the compact mode.
+  bool is_compact() const { return compact_; }
+
+  /// Return the number of macrostates.
+  int size() const;
+
+  /// Return the average of a given macrostate and state change.
+  double average(const int macro, const int state_change) const;
+
+  /// Return the number of values added to a given macrostate and state change.
+  double num_values(const int macro, const int state_change) const;
+
   /// Update the ln_prob according to the collection matrix.
   void compute_ln_prob(LnProbability * ln_prob,
     /// optionaly compute the ln_prob from a block (if != -1).
-    const int block = -1) const;
-
-  /// Return the matrix
-  const std::vector<std::vector<Accumulator> >& matrix() const { return matrix_; }
+    const int block = -1,
+    /// Only recompute macrostates at or above this value, assuming that the
+    /// ln_prob of the lower macrostates are current.
+    /// Because the ln_prob of a macrostate depends upon neighboring rows of
+    /// the collection matrix, begin one below the lowest row that changed.
+    const int begin = 0,
+    /// If false, do not normalize.
+    const bool normalize = true) const;
+
+  /// Return the matrix (not compact).
+  const std::vector<std::vector<Accumulator> >& matrix() const;
 
 //  /// Return the standard deviation of the change in the ln_prob relative to
 //  /// the bin below.
@@ -105,7 +147,20 @@ class CollectionMatrix {
   double exp_for_boost_;
   std::vector<std::vector<Accumulator> > matrix_;
 
+  // compact mode, indexed by 2*macro + state_change
+  bool compact_ = false;
+  int max_blocks_;
+  std::vector<long double> sums_;
+  std::vector<double> counts_;
+  std::vector<long double> block_sums_;
+  std::vector<double> block_counts_;
+  std::vector<double> block_sizes_;
+  std::vector<std::vector<double> > blocks_;
+
   int visits_(const int macro, const int block, const bool lower) const;
+  const std::vector<double>& blocks_of_(const int macro,
+    const int state_change) const;
+  double block_stdev_(const int macro, const int state_change) const;
 };
 
 inline std::shared_ptr<CollectionMatrix> MakeCollectionMatrix(
@@ -17,6 +17,7 @@ namespace feasst {
 
 class Checkpoint;
 class Histogram;
+class SharedWindow;
 
 /**
   Container for holding a group of FlatHistogram MonteCarlo simulations
@@ -31,6 +32,48 @@ class Histogram;
   Left and right most windows can completely abandon completed macrostates.
   Also, left and right most don't lose macrostates if the entire window
   has already reached its completion criteria.
+
+  Alternatively, with balance_throughput, adjust bounds so that all windows
+  are estimated to complete at the same wall-clock time.
+  The number of trials per second, \f$R_i\f$, is measured for each window
+  while it runs.
+  The time for window \f$i\f$ to complete is then estimated as
+  \f$(S_i - s_i)M_i/R_i\f$, where \f$S_i\f$ is the number of iterations to
+  complete, \f$s_i\f$ is the current number of iterations and \f$M_i\f$ is
+  the number of macrostates in the window.
+  This assumes that the number of trials per iteration per macrostate is
+  similar in all windows.
+  Macrostates are moved between adjacent windows as long as this reduces
+  the larger of their two estimated times.
+  Thus, windows with expensive trials (e.g., high density) shrink.
+  Until trials per second are measured for every window, bounds are adjusted
+  based on the number of iterations as described above.
+
+  Windows may also run in separate processes, on one node or on multiple
+  nodes which share a filesystem, given a shared_file.
+  Each process calls run_window for its own window, which periodically
+  publishes the Bias and status of the window to a SharedWindow.
+  A separate coordinator process calls coordinate, which splices the
+  published collection matrices to write the ln_prob_file and bounds_file
+  until all windows are complete.
+
+  The coordinator also adjusts the bounds of windows in other processes.
+  For each boundary between neighboring windows, a new boundary is computed
+  from the published data as described above, except that without
+  balance_throughput only one macrostate is moved per adjustment.
+  The new bounds are requested through the SharedWindow of each window.
+  A window first grows into macrostates of its neighbor, copying the
+  published collection matrix of those macrostates, and only gives up
+  macrostates once the neighbor has published that it samples them.
+  Thus, every macrostate is always sampled by at least one window, and
+  macrostates sampled by two windows are taken from the window with the
+  most values.
+  A boundary is not adjusted again until both windows have published the
+  requested boundary.
+  Unlike adjust_bounds, the macrostate-dependent data of multistate Analyze
+  and Modify cannot be moved between windows in separate processes.
+  Thus, windows in separate processes may not have multistate Analyze or
+  Modify when bounds are adjusted.
  */
 class CollectionMatrixSplice {
  public:
@@ -45,6 +88,16 @@ class CollectionMatrixSplice {
     - num_adjust_per_write: number of adjustments per writing of ln_prob (default: 1)
     - bounds_file: file name for periodic output of bounds, if not empty
       (default: empty).
+      If balance_throughput, also output the trials per second of each window.
+    - balance_throughput: if true, adjust bounds based upon the measured
+      trials per second and iterations, as described above (default: false).
+    - shared_file: prefix of the files of each SharedWindow, which are
+      appended by the window index, for windows in separate processes
+      (default: empty).
+    - timeout_hours: in coordinate, terminate if a window which is not
+      complete has not published for this many hours, or if it has never
+      published within this many hours of the start of coordinate.
+      If <= 0, wait indefinitely (default: 1).
    */
   explicit CollectionMatrixSplice(argtype args = argtype());
   explicit CollectionMatrixSplice(argtype * args);
@@ -86,6 +139,18 @@ class CollectionMatrixSplice {
   /// Loop through all clones and swap bounds based on number of interations.
   void adjust_bounds();
 
+  /// Return the measured trials per second of each clone.
+  /// Values are zero if not yet measured.
+  const std::vector<double>& trials_per_second() const {
+    return trials_per_second_; }
+
+  /// Set the trials per second of a clone.
+  void set_trials_per_second(const int index, const double rate);
+
+  /// Return the number of macrostates to move from the lower to upper
+  /// window, based on balance_throughput (negative moves upper to lower).
+  int throughput_shift(const int lower_index) const;
+
   /// Write the bounds to file, if not empty.
   void write_bounds(
     /// optionally, print the header.
@@ -103,6 +168,33 @@ class CollectionMatrixSplice {
   /// Return the complete collection matrix.
   CollectionMatrix collection_matrix() const;
 
+  /// Write the Bias and status of a window to its shared_file.
+  void publish(const int index);
+
+  /// Run a single window in this process, publishing and applying the
+  /// requested bounds after every hours_per, until the window is complete.
+  /// The Checkpoint, if set, only writes the MonteCarlo of this window.
+  /// Thus, each window process requires a unique Checkpoint file_name.
+  void run_window(const int index);
+
+  /// Read all shared_files and return true if all windows were published.
+  bool read_published();
+
+  /// Return the complete collection matrix from the shared_files.
+  CollectionMatrix published_collection_matrix();
+
+  /// Request new bounds of windows in other processes, based on the
+  /// shared_files.
+  void adjust_published_bounds();
+
+  /// Apply the bounds requested of a window, as far as its neighbors allow.
+  /// The window may not have multistate Analyze or Modify.
+  void apply_requested_bounds(const int index);
+
+  /// Every hours_per, read the shared_files, adjust the bounds and write the
+  /// ln_prob_file and bounds_file, until all windows are complete.
+  void coordinate();
+
   /// Return the complete probability distribution.
   LnProbability ln_prob() const;
 
@@ -135,6 +227,25 @@ class CollectionMatrixSplice {
   int num_adjust_per_write_;
   int num_adjust_since_write_ = 0;
   std::string bounds_file_;
+  bool balance_throughput_;
+  std::vector<double> trials_per_second_;
+  std::string shared_file_;
+  double timeout_hours_;
+
+  // temporary and not serialized
+  std::vector<std::shared_ptr<SharedWindow> > shared_windows_;
+
+  void run_and_measure_(const int index, const double hours);
+  double seconds_per_macrostate_(const int index) const;
+  int throughput_shift_(int lower_size, int upper_size,
+    const double lower_seconds, const double upper_seconds) const;
+  SharedWindow * shared_(const int index);
+  void check_not_multistate_(const int index) const;
+  void write_(const std::string& file_name, const CollectionMatrix& cm) const;
+  void write_bounds_(const std::vector<int>& soft_min,
+                     const std::vector<int>& soft_max) const;
+  bool is_rate_written_() const {
+    return balance_throughput_ || !shared_file_.empty(); }
 };
 
 /// Construct CollectionMatrixSplice
@@ -96,7 +96,10 @@ class FlatHistogram : public Criteria {
       const int state_new,
       const bool endpoint) override;
 
-  void update() override { bias_->infrequent_update(*macrostate_); }
+  void update() override;
+
+  /// Return the wall clock hours spent in the infrequent updates of the Bias.
+  double bias_update_hours() const { return bias_update_hours_; }
 
   bool is_fh_equal(const FlatHistogram& flat_histogram,
     const double tolerance) const;
@@ -105,11 +108,17 @@ class FlatHistogram : public Criteria {
   int set_soft_max(const int index, const System& sys) override;
   int set_soft_min(const int index, const System& sys) override;
   void set_cm(const bool inc_max, const int macro, const Criteria& crit) override;
+  void set_cm(const bool inc_max, const int macro, const Bias& bias);
   void adjust_bounds(const bool left_most, const bool right_most,
     const bool left_complete, const bool right_complete,
     const bool all_min_size,
     const int min_size, const System& system, const System * upper_sys,
     Criteria * criteria, bool * adjusted_up, std::vector<int> * states) override;
+  void shift_bounds(const bool left_most, const bool right_most,
+    const bool all_min_size,
+    const int min_size, const System& system, const System& upper_sys,
+    Criteria * criteria, bool * adjusted_up, std::vector<int> * states,
+    const int shift) override;
   const FlatHistogram& flat_histogram() const override { return *this; }
   int soft_min() const override;
   int soft_max() const override;
@@ -130,6 +139,7 @@ class FlatHistogram : public Criteria {
   int macrostate_new_ = -1;
   int macrostate_current_ = -1;
   bool is_macrostate_set_ = false;
+  double bias_update_hours_ = 0.;
 
   // temporary
   Acceptance empty_;
@@ -140,6 +150,10 @@ class FlatHistogram : public Criteria {
     const bool all_min_size,
     const int min_size, const System& system, const System * upper_sys,
     Criteria * criteria);
+  bool move_macrostate_up_(const int min_size, const System& system,
+    Criteria * criteria, std::vector<int> * states);
+  bool move_macrostate_down_(const int min_size, const System& upper_sys,
+    Criteria * criteria, std::vector<int> * states);
 };
 
 inline std::shared_ptr<FlatHistogram> MakeFlatHistogram() {
@@ -0,0 +1,93 @@
+#ifndef FEASST_FLAT_HISTOGRAM_MACROSTATE_NUM_PARTICLES_ENERGY_H_
+#define FEASST_FLAT_HISTOGRAM_MACROSTATE_NUM_PARTICLES_ENERGY_H_
+
+#include "monte_carlo/include/constrain_num_particles.h"
+#include "flat_histogram/include/macrostate.h"
+
+namespace feasst {
+
+/**
+  Defines the macrostate to be both the number of particles, N, and the total
+  potential energy, U, of the system.
+  The two-dimensional (N, U) bins are flattened into a single index,
+  \f$b = b_N n_U + b_U\f$, where \f$b_N\f$ and \f$b_U\f$ are the bins of the
+  number of particles and energy Histograms, and \f$n_U\f$ is the number of
+  energy bins.
+  The value of this macrostate is the flattened index, and states outside of
+  either Histogram are not allowed.
+
+  Because a trial may change the energy by many bins, use a Bias which does
+  not assume transitions between adjacent macrostates, such as
+  WangLandauSparse.
+  Soft limits are not supported.
+ */
+class MacrostateNumParticlesEnergy : public Macrostate {
+ public:
+  /**
+   args:
+   - particle_type: number of particles of type. If -1 (default), count all
+     types.
+  */
+  MacrostateNumParticlesEnergy(const Histogram& num_particles,
+    const Histogram& energy,
+    argtype args = argtype());
+  MacrostateNumParticlesEnergy(const Histogram& num_particles,
+    const Histogram& energy,
+    argtype * args);
+
+  /**
+    Flattened version of the above constructor that takes Histogram arguments.
+    The width, max and min arguments define the number of particles Histogram,
+    while the following arguments define the energy Histogram.
+
+    args:
+    - energy_width: constant bin width of the energy.
+    - energy_max: maximum energy.
+    - energy_min: minimum energy.
+   */
+  explicit MacrostateNumParticlesEnergy(argtype args = argtype());
+  explicit MacrostateNumParticlesEnergy(argtype * args);
+
+  /// Return the number of particles Histogram.
+  const Histogram& num_particles() const { return num_particles_; }
+
+  /// Return the energy Histogram.
+  const Histogram& energy() const { return energy_; }
+
+  /// Return the number of particles at the center of the flattened bin.
+  double num_particles(const int bin) const;
+
+  /// Return the energy at the center of the flattened bin.
+  double energy(const int bin) const;
+
+  double value(const System& system,
+    const Criteria& criteria,
+    const Acceptance& acceptance) const override;
+  std::shared_ptr<Macrostate> create(std::istream& istr) const override;
+  std::shared_ptr<Macrostate> create(argtype * args) const override;
+  void serialize(std::ostream& ostr) const override;
+  MacrostateNumParticlesEnergy(std::istream& istr);
+  virtual ~MacrostateNumParticlesEnergy() {}
+
+ private:
+  ConstrainNumParticles num_;
+  Histogram num_particles_;
+  Histogram energy_;
+};
+
+inline std::shared_ptr<MacrostateNumParticlesEnergy>
+    MakeMacrostateNumParticlesEnergy(const Histogram& num_particles,
+    const Histogram& energy,
+    argtype args = argtype()) {
+  return std::make_shared<MacrostateNumParticlesEnergy>(num_particles, energy,
+                                                        args);
+}
+
+inline std::shared_ptr<MacrostateNumParticlesEnergy>
+    MakeMacrostateNumParticlesEnergy(argtype args = argtype()) {
+  return std::make_shared<MacrostateNumParticlesEnergy>(args);
+}
+
+}  // namespace feasst
+
+#endif  // FEASST_FLAT_HISTOGRAM_MACROSTATE_NUM_PARTICLES_ENERGY_H_
@@ -0,0 +1,98 @@
+#ifndef FEASST_FLAT_HISTOGRAM_SHARED_WINDOW_H_
+#define FEASST_FLAT_HISTOGRAM_SHARED_WINDOW_H_
+
+#include <string>
+#include <memory>
+
+namespace feasst {
+
+class Bias;
+class FlatHistogram;
+
+/**
+  Share the Bias and status of a FlatHistogram window with other processes
+  through files.
+  One process, which runs the window, writes to the file while another
+  process, such as the coordinator described in CollectionMatrixSplice,
+  reads from the file.
+  The coordinator may also request new soft bounds of the window through a
+  second file, with the same name appended by "_bounds".
+
+  Each write goes to a temporary file which then replaces the previous file
+  with a rename, so that a reader always sees a complete file.
+  Processes may be on the same node or on different nodes which share a
+  filesystem.
+  On a network filesystem, the latest write may not be visible to another
+  node until the attribute cache of that node expires (e.g., seconds).
+
+  The file contains the soft bounds, number of iterations, completion, trials
+  per second and the wall-clock time of the write, followed by the serialized
+  Bias.
+  Thus, the CollectionMatrix of a TransitionMatrix retains its block
+  statistics.
+ */
+class SharedWindow {
+ public:
+  explicit SharedWindow(const std::string& file_name);
+
+  /// Return the file name.
+  const std::string& file_name() const { return file_name_; }
+
+  /// Write the FlatHistogram.
+  void write(const FlatHistogram& flat_histogram,
+    /// optionally, the number of trials per second of the window.
+    const double trials_per_second = 0.);
+
+  /// Read the file and return true if a FlatHistogram has been written.
+  bool read();
+
+  /// Return the soft minimum bin of the window, as last read.
+  int soft_min() const { return soft_min_; }
+
+  /// Return the soft maximum bin of the window, as last read.
+  int soft_max() const { return soft_max_; }
+
+  /// Return the number of iterations, as last read.
+  int num_iterations() const { return num_iterations_; }
+
+  /// Return the number of iterations to complete, as last read.
+  int num_iterations_to_complete() const {
+    return num_iterations_to_complete_; }
+
+  /// Return true if the window was complete, as last read.
+  bool is_complete() const { return is_complete_; }
+
+  /// Return the trials per second, as last read.
+  double trials_per_second() const { return trials_per_second_; }
+
+  /// Return the wall-clock time of the write, in seconds since the epoch,
+  /// as last read.
+  double seconds() const { return seconds_; }
+
+  /// Return the Bias, as last read.
+  const Bias& bias() const;
+
+  /// Request new soft bounds of the window.
+  void request_bounds(const int soft_min, const int soft_max) const;
+
+  /// Return true if new soft bounds were requested, and obtain them.
+  bool requested_bounds(int * soft_min, int * soft_max) const;
+
+  /// Return the current wall-clock time in seconds since the epoch.
+  static double seconds_since_epoch();
+
+ private:
+  std::string file_name_;
+  int soft_min_ = 0;
+  int soft_max_ = 0;
+  int num_iterations_ = 0;
+  int num_iterations_to_complete_ = 0;
+  bool is_complete_ = false;
+  double trials_per_second_ = 0.;
+  double seconds_ = 0.;
+  std::shared_ptr<Bias> bias_;
+};
+
+}  // namespace feasst
+
+#endif  // FEASST_FLAT_HISTOGRAM_SHARED_WINDOW_H_
@@ -36,6 +36,11 @@ namespace feasst {
   Wang-Landau to initialize the transition matrix.
   This makes WLTM less sensitive than TM to the choice of chemical potential in terms
   of efficiency.
+
+  The ln_prob is computed incrementally, beginning from the lowest macrostate
+  that changed in the collection matrix since the previous computation, and
+  is only normalized when requested.
+  The bias does not require normalization.
  */
 class TransitionMatrix : public Bias {
  public:
@@ -71,8 +76,9 @@ class TransitionMatrix : public Bias {
   int num_iterations_to_complete() const override { return min_sweeps_;}
   void set_num_iterations_to_complete(const int sweeps) override;
   int num_iterations(const int state, const Macrostate& macro) const override;
-  const LnProbability& ln_prob() const override {
-    return ln_prob_; }
+  double ln_bias(const int bin_new, const int bin_old) const override {
+    return ln_prob_.value(bin_old) - ln_prob_.value(bin_new); }
+  const LnProbability& ln_prob() const override;
   void resize(const int size);
   void resize(const Histogram& histogram) override {
     resize(histogram.size()); }
@@ -107,7 +113,7 @@ class TransitionMatrix : public Bias {
 
  private:
   CollectionMatrix collection_;
-  LnProbability ln_prob_;
+  mutable LnProbability ln_prob_;
   std::vector<std::vector<int> > visits_;
   int min_visits_ = 0;
   int num_sweeps_ = 0;
@@ -116,6 +122,10 @@ class TransitionMatrix : public Bias {
   int average_visits_ = 0;
   int new_sweep_ = 0;
 
+  // temporary and not serialized
+  int begin_ = 0;
+  mutable bool is_normalized_ = true;
+
   // find minimum visits in soft range
   int min_vis_calc_(const Macrostate& macro) const;
 };
@@ -13,6 +13,15 @@ namespace feasst {
   Wang Landau flat histogram bias.
   https://doi.org/10.1103/PhysRevLett.86.2050
   https://doi.org/10.1063/1.1615966
+
+  Optionally, use the 1/t algorithm, which avoids the saturation of the error
+  when the amount added to the ln_prob is reduced by flatness checks alone.
+  https://doi.org/10.1103/PhysRevE.75.046701
+  Flatness checks reduce the amount added to the ln_prob, as usual, until it
+  is less than \f$1/t\f$ after a flatness check, where \f$t\f$ is the
+  number of updates divided by the number of macrostates.
+  Afterward, the amount added is \f$1/t\f$ for every update, and flatness
+  checks only count the number of iterations.
  */
 class WangLandau : public Bias {
  public:
@@ -29,6 +38,8 @@ class WangLandau : public Bias {
       this threshold (default: 0.8).
     - min_visit_per_macro: The minimum number of visits for each macrostate
       required during flatness check (default: 10^3).
+    - one_over_t: if true, use the 1/t algorithm described above
+      (default: false).
    */
   explicit WangLandau(argtype args = argtype());
   explicit WangLandau(argtype * args);
@@ -52,6 +63,12 @@ class WangLandau : public Bias {
   std::string write_per_bin_header() const override;
   void set_ln_prob(const LnProbability& ln_prob) override;
   const int num_flatness() const { return num_flatness_; }
+
+  /// Return the amount currently added to the ln_prob upon visiting a state.
+  double add_to_ln_probability() const { return add_to_ln_probability_; }
+
+  /// Return true if the 1/t stage has begun.
+  bool is_one_over_t() const { return is_one_over_t_ == 1; }
   std::shared_ptr<Bias> create(std::istream& istr) const override {
     return std::make_shared<WangLandau>(istr); }
   std::shared_ptr<Bias> create(argtype * args) const override {
@@ -75,6 +92,10 @@ class WangLandau : public Bias {
   int num_flatness_ = 0;
   int min_flatness_ = 0;
 
+  bool one_over_t_;
+  int is_one_over_t_ = 0;
+  double num_updates_ = 0.;
+
   void flatness_check_();
   /// Perform update when the visited states histogram is found to be flat.
   void flatness_update_();
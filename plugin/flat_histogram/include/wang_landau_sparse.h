@@ -0,0 +1,108 @@
+#ifndef FEASST_FLAT_HISTOGRAM_WANG_LANDAU_SPARSE_H_
+#define FEASST_FLAT_HISTOGRAM_WANG_LANDAU_SPARSE_H_
+
+#include <map>
+#include <vector>
+#include <memory>
+#include "utils/include/arguments.h"
+#include "flat_histogram/include/bias.h"
+
+namespace feasst {
+
+/**
+  Wang Landau flat histogram bias, as described in WangLandau, which only
+  stores the macrostates that have been visited.
+  This is intended for multidimensional macrostates, such as
+  MacrostateNumParticlesEnergy, where most of the bins may be inaccessible.
+
+  Macrostates that have not been visited have a natural log of the probability
+  of zero, and thus are favored over visited macrostates.
+  The flatness check only considers the visited macrostates.
+
+  The ln_prob is normalized over the visited macrostates, while the remaining
+  macrostates are given a value of -NEAR_INFINITY.
+ */
+class WangLandauSparse : public Bias {
+ public:
+  /**
+    args:
+    - min_flatness : Number of flatness checks required for completion.
+    - add_to_ln_probability : The initial amount to add to the natural log of
+      the macrostate probability upon visiting that state (default: 1.0).
+    - reduce_ln_probability : Reduce the amount to add to the natural log of the
+      macrostate probability by multiplcation of this factor upon reaching a
+      sufficiently flat histogram (default: 0.5).
+    - flatness_threshold : The visited states histogram is determined to be flat
+      when the percentage between minimum visisted states and average reaches
+      this threshold (default: 0.8).
+    - min_visit_per_macro: The minimum number of visits for each visited
+      macrostate required during flatness check (default: 10^3).
+   */
+  explicit WangLandauSparse(argtype args = argtype());
+  explicit WangLandauSparse(argtype * args);
+  double ln_bias(const int bin_new, const int bin_old) const override {
+    return value_(bin_old) - value_(bin_new); }
+  void update(
+    const int macrostate_old,
+    const int macrostate_new,
+    const double ln_metropolis_prob,
+    const bool is_accepted,
+    const bool is_endpoint,
+    const Macrostate& macro) override;
+  int num_iterations_to_complete() const override { return min_flatness_; }
+  void set_num_iterations_to_complete(const int flatness) override;
+  int num_iterations(const int state, const Macrostate& macro) const override {
+    return num_flatness_; }
+  const LnProbability& ln_prob() const override;
+  void resize(const Histogram& histogram) override;
+  void infrequent_update(const Macrostate& macro) override;
+  std::string write() const override;
+  std::string write_per_bin(const int bin) const override;
+  std::string write_per_bin_header() const override;
+  void set_ln_prob(const LnProbability& ln_prob) override;
+  const int num_flatness() const { return num_flatness_; }
+
+  /// Return the visited macrostates, in the order they were first visited.
+  const std::vector<int>& bins() const { return bins_; }
+
+  /// Return the number of visits to a macrostate since the last flatness.
+  int visited(const int bin) const;
+
+  std::shared_ptr<Bias> create(std::istream& istr) const override {
+    return std::make_shared<WangLandauSparse>(istr); }
+  std::shared_ptr<Bias> create(argtype * args) const override {
+    return std::make_shared<WangLandauSparse>(args); }
+  void serialize(std::ostream& ostr) const override;
+  explicit WangLandauSparse(std::istream& istr);
+  virtual ~WangLandauSparse() {}
+
+ private:
+  double add_to_ln_probability_ = 0;
+  double reduce_ln_probability_ = 0;
+  double flatness_threshold_ = 0;
+  int min_visit_per_macro_;
+  int num_flatness_ = 0;
+  int min_flatness_ = 0;
+  int size_ = 0;
+  std::vector<int> bins_;
+  std::vector<double> ln_prob_;
+  std::vector<int> visited_states_;
+
+  // temporary and not serialized
+  std::map<int, int> index_;
+  mutable LnProbability ln_prob_dense_;
+  mutable bool is_dense_current_ = false;
+
+  int index_of_(const int bin) const;
+  double value_(const int bin) const;
+  void add_bin_(const int bin, const double ln_prob, const int visited);
+};
+
+inline std::shared_ptr<WangLandauSparse> MakeWangLandauSparse(
+    argtype args = argtype()) {
+  return std::make_shared<WangLandauSparse>(args);
+}
+
+}  // namespace feasst
+
+#endif  // FEASST_FLAT_HISTOGRAM_WANG_LANDAU_SPARSE_H_
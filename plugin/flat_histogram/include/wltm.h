@@ -12,6 +12,16 @@ namespace feasst {
 
 /**
   Begin with WangLandau and end with TransitionMatrix.
+
+  By default, the switch to TransitionMatrix occurs after a fixed number of
+  WangLandau flatness checks, WangLandau::min_flatness.
+  Optionally, the switch occurs as soon as the statistical error of the
+  collection matrix is sufficiently small.
+  The error is estimated as the largest, over the macrostates in the soft
+  range, standard deviation of the average change in the ln_prob between
+  neighboring macrostates, computed from the blocks of the collection matrix
+  (see the delta_ln_prob_stdev column of CollectionMatrix::write_per_bin).
+  In this case, WangLandau::min_flatness is an upper limit.
  */
 class WLTM : public Bias {
  public:
@@ -26,6 +36,12 @@ class WLTM : public Bias {
     - min_collect_sweeps: In addition to WangLandau::min_flatness, do not use
       TransitionMatrix as bias until it has this minimum number of sweeps.
       If -1, do nothing (default: -1).
+    - max_delta_ln_prob_stdev: If > 0, switch to TransitionMatrix as bias
+      when the statistical error of the collection matrix, as described above,
+      is less than this value.
+      If -1, only use WangLandau::min_flatness (default: -1).
+    - min_error_blocks: The minimum number of blocks of the collection matrix
+      required to estimate the statistical error (default: 5).
    */
   explicit WLTM(argtype args = argtype());
   explicit WLTM(argtype * args);
@@ -45,6 +61,7 @@ class WLTM : public Bias {
   int num_iterations(const int state, const Macrostate& macro) const override;
   const TransitionMatrix& transition_matrix() const {
     return const_cast<TransitionMatrix&>(*transition_matrix_); }
+  double ln_bias(const int bin_new, const int bin_old) const override;
   const LnProbability& ln_prob() const override;
   void resize(const Histogram& histogram) override;
   void infrequent_update(const Macrostate& macro) override;
@@ -62,6 +79,13 @@ class WLTM : public Bias {
     return transition_matrix().visits(macro, index); }
   bool is_adjust_allowed(const Macrostate& macro) const override;
 
+  /// Return the statistical error of the collection matrix, as described
+  /// above. Return NEAR_INFINITY if there are not enough blocks.
+  double delta_ln_prob_stdev(const Macrostate& macro) const;
+
+  /// Return true if the switch was triggered by the statistical error.
+  bool is_error_converged() const { return is_error_converged_ == 1; }
+
   std::shared_ptr<Bias> create(std::istream& istr) const override;
   std::shared_ptr<Bias> create(argtype * args) const override {
     return std::make_shared<WLTM>(args); }
@@ -74,9 +98,13 @@ class WLTM : public Bias {
   int min_flatness_;
   int min_collect_sweeps_;
   int production_ = 0;
+  double max_delta_ln_prob_stdev_;
+  int min_error_blocks_;
+  int is_error_converged_ = 0;
   std::shared_ptr<WangLandau> wang_landau_;
   std::shared_ptr<TransitionMatrix> transition_matrix_;
 
+  bool is_wl_flatness_() const;
   bool is_wl_bias_(const Macrostate& macro) const;
 };
 
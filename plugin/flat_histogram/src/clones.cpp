@@ -8,13 +8,18 @@
 //#endif
 #include <thread>         // std::this_thread::sleep_for
 #include <chrono>         // std::chrono::seconds
+#include <cmath>
 #include <fstream>
+#include <utility>        // std::swap
 #include "utils/include/debug.h"
 #include "utils/include/serialize.h"
 #include "utils/include/checkpoint.h"
 #include "math/include/constants.h"
 #include "math/include/histogram.h"
 #include "math/include/utils_math.h"
+#include "math/include/random.h"
+#include "system/include/thermo_params.h"
+#include "steppers/include/extensive_moments.h"
 #include "flat_histogram/include/flat_histogram.h"
 #include "flat_histogram/include/clones.h"
 
@@ -85,7 +90,13 @@ void Clones::initialize(const int upper_index, argtype args) {
       "reached maximum batch: " << batch);
   }
 
+  seed_(upper_index - 1, upper_index);
+}
+
+void Clones::seed_(const int lower_index, const int upper_index) {
   DEBUG("send configuration to upper");
+  MonteCarlo * lower = clones_[lower_index].get();
+  MonteCarlo * upper = clones_[upper_index].get();
   //upper->set(deep_copy(lower->system()));
   upper->get_system()->get_configuration()->copy_particles(
     lower->configuration(),
@@ -96,11 +107,102 @@ void Clones::initialize(const int upper_index, argtype args) {
 }
 
 void Clones::initialize(argtype args) {
+  if (boolean("pipeline", &args, false)) {
+    #ifdef _OPENMP
+    initialize_pipeline_(args);
+    return;
+    #else // _OPENMP
+    WARN("OMP not detected");
+    args.erase("seed_from_any");
+    #endif // _OPENMP
+  }
   for (int upper_index = 1; upper_index < num(); ++upper_index) {
     initialize(upper_index, args);
   }
 }
 
+void Clones::initialize_pipeline_(argtype args) {
+#ifdef _OPENMP
+  const int attempt_batch = integer("attempt_batch", &args, 1);
+  const int max_batch = integer("max_batch", &args, -1);
+  const bool seed_from_any = boolean("seed_from_any", &args, false);
+  FEASST_CHECK_ALL_USED(args);
+  Acceptance empty;
+  std::vector<int> is_seeded(num(), 0);
+  is_seeded[0] = 1;
+  int num_seeded = 1;
+  for (int index = 1; index < num(); ++index) {
+    const MonteCarlo& mc = clone(index);
+    if (mc.criteria().flat_histogram().macrostate().is_allowed(
+          mc.system(), mc.criteria(), empty)) {
+      DEBUG(index << " already initialized");
+      is_seeded[index] = 1;
+      ++num_seeded;
+    }
+  }
+  bool any_terminated = false;
+  #pragma omp parallel
+  {
+    const int thread = omp_get_thread_num();
+    const int num_thread = static_cast<int>(omp_get_num_threads());
+    try {
+      ASSERT(num() <= num_thread, "more clones: " << num() << " than OMP threads:"
+        << num_thread << ". Use \"export OMP_NUM_THREADS=\" to set OMP threads.");
+      if (thread < num()) {
+        MonteCarlo * mc = clones_[thread].get();
+        int batch = 0;
+        bool done = false;
+        while (!done) {
+          bool seeded;
+          #pragma omp critical(clones_seed)
+          {
+            seeded = (is_seeded[thread] == 1);
+            done = (num_seeded == num() || any_terminated);
+          }
+          if (done) break;
+          if (!seeded) {
+            // wait for a configuration from a lower clone
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            continue;
+          }
+          mc->attempt(attempt_batch);
+          ++batch;
+
+          // send this configuration to an uninitialized clone that overlaps
+          int first = thread + 1, last = thread + 1;
+          if (seed_from_any) last = num() - 1;
+          for (int upper = first; upper <= std::min(last, num() - 1); ++upper) {
+            const Macrostate& macro =
+              clone(upper).criteria().flat_histogram().macrostate();
+            #pragma omp critical(clones_seed)
+            {
+              if (is_seeded[upper] == 0 &&
+                  macro.is_allowed(mc->system(), mc->criteria(), empty)) {
+                DEBUG(thread << " seeds " << upper);
+                seed_(thread, upper);
+                is_seeded[upper] = 1;
+                ++num_seeded;
+              }
+            }
+          }
+          ASSERT(max_batch == -1 || batch < max_batch,
+            "reached maximum batch: " << batch);
+        }
+      }
+    } catch(const feasst::CustomException& e) {
+      WARN(e.what());
+      #pragma omp critical(clones_seed)
+      {
+        any_terminated = true;
+      }
+    }
+  }
+  ASSERT(!any_terminated, "Clones::initialize was terminated.");
+#else // _OPENMP
+  FATAL("Not complied with OMP");
+#endif // _OPENMP
+}
+
 void Clones::run_until_complete(argtype args) {
 #ifdef _OPENMP
   run_until_complete_omp_(args);
@@ -134,10 +236,15 @@ void Clones::run_until_complete_omp_(argtype run_args,
   if (used("ln_prob_file", run_args)) {
     ln_prob_file = str("ln_prob_file", &run_args);
   }
+  const bool swap = boolean("swap", &run_args, false);
   FEASST_CHECK_ALL_USED(run_args);
+  ASSERT(!swap || !init, "swap is not implemented with initialization");
   std::vector<bool> is_complete(num(), false);
   std::vector<bool> is_initialized(num(), false);
   is_initialized[0] = true;
+  bool all_complete = false;
+  bool any_terminated = false;
+  int last_num_iterations = -1;
   #pragma omp parallel
   {
     const int thread = omp_get_thread_num();
@@ -165,18 +272,11 @@ void Clones::run_until_complete_omp_(argtype run_args,
 
         // continue running while waiting for all threads to complete
         if (clone->criteria().is_complete()) is_complete[thread] = true;
-        while (!are_all_complete(is_complete)) {
+        while (!swap && !are_all_complete(is_complete)) {
           clone->attempt(omp_batch);
           if (clone->criteria().is_complete()) is_complete[thread] = true;
-          if (thread == 0) {
-            if (!ln_prob_file.empty()) {
-              std::ofstream file;
-              file.open(ln_prob_file);
-              for (const double value : ln_prob().values()) {
-                file << value << std::endl;
-              }
-              file.close();
-            }
+          if (thread == 0 && !ln_prob_file.empty()) {
+            write_ln_prob_(ln_prob_file);
           }
         }
       }
@@ -184,13 +284,58 @@ void Clones::run_until_complete_omp_(argtype run_args,
       WARN(e.what());
       terminated = true;
     }
+
+    // with swaps, all threads synchronize after each batch
+    if (swap && !terminated) {
+      while (!all_complete) {
+        if (thread < num()) {
+          try {
+            MonteCarlo * clone = clones_[thread].get();
+            clone->attempt(omp_batch);
+            if (clone->criteria().is_complete()) is_complete[thread] = true;
+          } catch(const feasst::CustomException& e) {
+            WARN(e.what());
+            terminated = true;
+            any_terminated = true;
+          }
+        }
+        #pragma omp barrier
+        if (thread == 0) {
+          if (!any_terminated) {
+            try {
+              for (int upper_index = 1; upper_index < num(); ++upper_index) {
+                attempt_swap(upper_index);
+              }
+              // splicing every batch would stall the other threads
+              int num_iterations = 0;
+              for (const std::shared_ptr<MonteCarlo>& clone : clones_) {
+                num_iterations +=
+                  clone->criteria().flat_histogram().num_iterations();
+              }
+              if (!ln_prob_file.empty() &&
+                  (num_iterations != last_num_iterations ||
+                   are_all_complete(is_complete))) {
+                write_ln_prob_(ln_prob_file);
+                last_num_iterations = num_iterations;
+              }
+            } catch(const feasst::CustomException& e) {
+              WARN(e.what());
+              terminated = true;
+              any_terminated = true;
+            }
+          }
+          all_complete = any_terminated || are_all_complete(is_complete);
+        }
+        #pragma omp barrier
+      }
+    }
     DEBUG("terminated: " << terminated);
 
     if (thread == 0 && checkpoint_) checkpoint_->write(*this);
     if (thread < num()) clones_[thread]->write_checkpoint();
 
     #pragma omp barrier
-    if (terminated && thread == 0) {
+    if ((terminated || any_terminated) && thread == 0) {
       FATAL("Clones::run_until_complete_omp was terminated.");
     }
   }
@@ -200,6 +345,58 @@ FATAL("Not complied with OMP");
 #endif // _OPENMP
 }
 
+void Clones::write_ln_prob_(const std::string& file_name) const {
+  std::ofstream file;
+  file.open(file_name);
+  for (const double value : ln_prob().values()) {
+    file << value << std::endl;
+  }
+  file.close();
+}
+
+bool Clones::attempt_swap(const int upper_index) {
+  ASSERT(upper_index > 0 && upper_index < num(),
+    "upper_index: " << upper_index << " is out of range");
+  if (static_cast<int>(swaps_.size()) != num() - 1) {
+    swaps_.resize(num() - 1);
+  }
+  MonteCarlo * lower = clones_[upper_index - 1].get();
+  MonteCarlo * upper = clones_[upper_index].get();
+  ASSERT(lower->system().thermo_params().is_equal(
+    upper->system().thermo_params()),
+    "swaps require the same ThermoParams in each clone");
+  const FlatHistogram& fh_lower = lower->criteria().flat_histogram();
+  const FlatHistogram& fh_upper = upper->criteria().flat_histogram();
+  const Macrostate& macro_lower = fh_lower.macrostate();
+  const Macrostate& macro_upper = fh_upper.macrostate();
+  Acceptance empty;
+  bool accepted = false;
+  if (macro_upper.is_allowed(lower->system(), lower->criteria(), empty) &&
+      macro_lower.is_allowed(upper->system(), upper->criteria(), empty)) {
+    const int lower_in_lower =
+      macro_lower.bin(lower->system(), lower->criteria(), empty);
+    const int upper_in_lower =
+      macro_lower.bin(upper->system(), upper->criteria(), empty);
+    const int lower_in_upper =
+      macro_upper.bin(lower->system(), lower->criteria(), empty);
+    const int upper_in_upper =
+      macro_upper.bin(upper->system(), upper->criteria(), empty);
+    const double ln_prob_acc =
+      fh_lower.bias().ln_bias(upper_in_lower, lower_in_lower) +
+      fh_upper.bias().ln_bias(lower_in_upper, upper_in_upper);
+    DEBUG("ln_prob_acc " << ln_prob_acc);
+    if (ln_prob_acc >= 0. ||
+        lower->get_random()->uniform() < std::exp(ln_prob_acc)) {
+      std::swap(*lower->get_system(), *upper->get_system());
+      lower->initialize_criteria();
+      upper->initialize_criteria();
+      accepted = true;
+    }
+  }
+  swaps_[upper_index - 1].accumulate(static_cast<double>(accepted));
+  return accepted;
+}
+
 void Clones::initialize_and_run_until_complete(argtype run_args,
                                                argtype init_args) {
 #ifdef _OPENMP
@@ -316,16 +513,62 @@ LnProbability Clones::ln_prob(Histogram * macrostates,
   return lnpi;
 }
 
+std::vector<ExtensiveMoments> Clones::extensive_moments(
+    const std::string analyze_name) const {
+  std::vector<ExtensiveMoments> moments;
+  std::vector<double> macros;
+  for (int index = 0; index < num(); ++index) {
+    const MonteCarlo& mc = clone(index);
+    const std::vector<int> ndx = SeekAnalyze().index(analyze_name, mc);
+    ASSERT(ndx[0] != -1, "analyze_name: " << analyze_name << " not found");
+    ASSERT(ndx[1] != -1, "analyze_name: " << analyze_name
+      << " is not multistate");
+    const auto& analyzers = mc.analyze(ndx[0]).analyzers();
+    const Macrostate& macrostate =
+      mc.criteria().flat_histogram().macrostate();
+    ASSERT(static_cast<int>(analyzers.size()) ==
+      macrostate.histogram().size(), "number of states: " << analyzers.size()
+      << " does not match the number of macrostates");
+
+    // find the first macrostate of this clone in those of the previous
+    int spliced = 0;
+    if (index > 0) {
+      spliced = static_cast<int>(macros.size()) - 1;
+      while (spliced >= 0 &&
+             std::abs(macros[spliced] - macrostate.value(0)) > NEAR_ZERO) {
+        --spliced;
+      }
+      ASSERT(spliced >= 0, "No overlap of clone: " << index);
+    }
+    for (int bin = 0; bin < static_cast<int>(analyzers.size()); ++bin) {
+      const ExtensiveMoments * moment =
+        dynamic_cast<const ExtensiveMoments*>(analyzers[bin].get());
+      ASSERT(moment, "analyze_name: " << analyze_name
+        << " is not ExtensiveMoments");
+      ASSERT(moment->is_compact(), "requires the compact mode");
+      if (spliced < static_cast<int>(moments.size())) {
+        moments[spliced].merge(*moment);
+      } else {
+        moments.push_back(*moment);
+        macros.push_back(macrostate.value(bin));
+      }
+      ++spliced;
+    }
+  }
+  return moments;
+}
+
 void Clones::serialize(std::ostream& ostr) const {
-  feasst_serialize_version(2845, ostr);
+  feasst_serialize_version(2846, ostr);
   feasst_serialize(clones_, ostr);
+  feasst_serialize_fstobj(swaps_, ostr);
 //  feasst_serialize(checkpoint_, ostr);
   feasst_serialize_endcap("Clones", ostr);
 }
 
 Clones::Clones(std::istream& istr) {
   const int version = feasst_deserialize_version(istr);
-  ASSERT(version == 2845, "version: " << version);
+  ASSERT(version >= 2845 && version <= 2846, "version: " << version);
   // HWH for unknown reasons, this does not work
   //feasst_deserialize(&clones_, istr);
   int dim1;
@@ -338,6 +581,9 @@ Clones::Clones(std::istream& istr) {
       clones_[index] = std::make_shared<MonteCarlo>(istr);
     }
   }
+  if (version >= 2846) {
+    feasst_deserialize_fstobj(&swaps_, istr);
+  }
 //  // HWH for unknown reasons, this function template does not work.
 //  //feasst_deserialize(checkpoint_, istr);
 //  { int existing;
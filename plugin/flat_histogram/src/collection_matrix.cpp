@@ -17,6 +17,10 @@ CollectionMatrix::CollectionMatrix(argtype * args) {
   visits_per_delta_ln_prob_boost_ = integer("visits_per_delta_ln_prob_boost",
     args, -1);
   exp_for_boost_ = dble("exp_for_boost", args, 2);
+  compact_ = boolean("compact", args, false);
+  max_blocks_ = integer("max_blocks", args, 32);
+  ASSERT(max_blocks_ > 0 && max_blocks_ % 2 == 0,
+    "max_blocks: " << max_blocks_ << " must be even and greater than zero");
 }
 CollectionMatrix::CollectionMatrix(argtype args)
   : CollectionMatrix(&args) {
@@ -24,28 +28,80 @@ CollectionMatrix::CollectionMatrix(argtype args)
 }
 
 int CollectionMatrix::visits_(const int macro, const int block, const bool lower) const {
+  const int state_change = lower ? 1 : 0;
   if (block == -1) {
-    if (lower) {
-      return matrix_[macro][1].num_values();
-    } else {
-      return matrix_[macro][0].num_values();
+    return num_values(macro, state_change);
+  }
+  return static_cast<int>(blocks_of_(macro, state_change).size());
+}
+
+const std::vector<double>& CollectionMatrix::blocks_of_(const int macro,
+    const int state_change) const {
+  if (compact_) {
+    return blocks_[2*macro + state_change];
+  }
+  return matrix_[macro][state_change].blocks()[0];
+}
+
+const std::vector<std::vector<Accumulator> >& CollectionMatrix::matrix() const {
+  ASSERT(!compact_, "matrix is not available in the compact mode");
+  return matrix_;
+}
+
+int CollectionMatrix::size() const {
+  if (compact_) {
+    return static_cast<int>(sums_.size())/2;
+  }
+  return static_cast<int>(matrix_.size());
+}
+
+double CollectionMatrix::average(const int macro,
+    const int state_change) const {
+  if (compact_) {
+    const int index = 2*macro + state_change;
+    if (counts_[index] > 0) {
+      return static_cast<double>(sums_[index]/counts_[index]);
     }
-  } else {
-    if (lower) {
-      return matrix_[macro][1].blocks()[0].size();
-    } else {
-      return matrix_[macro][0].blocks()[0].size();
+    return 0.;
+  }
+  return matrix_[macro][state_change].average();
+}
+
+double CollectionMatrix::num_values(const int macro,
+    const int state_change) const {
+  if (compact_) {
+    return counts_[2*macro + state_change];
+  }
+  return matrix_[macro][state_change].num_values();
+}
+
+double CollectionMatrix::block_stdev_(const int macro,
+    const int state_change) const {
+  if (compact_) {
+    const std::vector<double>& blocks = blocks_of_(macro, state_change);
+    const int num = static_cast<int>(blocks.size());
+    if (num > 10) {
+      Accumulator acc({{"max_block_operations", "0"}, {"num_moments", "3"}});
+      for (const double block : blocks) {
+        acc.accumulate(block);
+      }
+      return acc.stdev_of_av();
     }
+    return 0.;
   }
-  FATAL("unrecognized");
+  return matrix_[macro][state_change].block_stdev();
 }
 
 void CollectionMatrix::compute_ln_prob(
     LnProbability * ln_prob,
-    const int block) const {
+    const int block,
+    const int begin,
+    const bool normalize) const {
   ASSERT(ln_prob->size() > 0, "error");
-  ln_prob->set_value(0, 0.);
-  for (int macro = 1; macro < ln_prob->size(); ++macro) {
+  if (begin <= 0) {
+    ln_prob->set_value(0, 0.);
+  }
+  for (int macro = std::max(1, begin); macro < ln_prob->size(); ++macro) {
     const double ln_prob_previous = ln_prob->value(macro - 1);
 //    if (block == -1) INFO("ln_prob_previous " << ln_prob_previous);
     const int vis_up = visits_(macro - 1, block, true);
@@ -57,8 +113,7 @@ void CollectionMatrix::compute_ln_prob(
           //delta_ln_prob += 0.01*vis_down/visits_per_delta_ln_prob_boost_;
           bool boost = true;
           if (exp_for_boost_ > 0 && macro < ln_prob->size() - 1) {
-            const double ratio = matrix_[macro][0].average()/
-                                 matrix_[macro+1][0].average();
+            const double ratio = average(macro, 0)/average(macro + 1, 0);
             if (ratio > pow(10, exp_for_boost_) || ratio < pow(10, -exp_for_boost_)) {
               boost = false;
               DEBUG("macro " << macro << " ratio " << ratio);
@@ -70,8 +125,7 @@ void CollectionMatrix::compute_ln_prob(
         } else if (vis_down == 0) {
           bool boost = true;
           if (exp_for_boost_ > 0 && macro > 1) {
-            const double ratio = matrix_[macro-1][1].average()/
-                                 matrix_[macro-2][1].average();
+            const double ratio = average(macro - 1, 1)/average(macro - 2, 1);
             if (ratio > pow(10, exp_for_boost_) || ratio < pow(10, -exp_for_boost_)) {
               boost = false;
               DEBUG("macro " << macro << " ratio " << ratio);
@@ -86,9 +140,9 @@ void CollectionMatrix::compute_ln_prob(
     } else {
       double prob_decrease;
       if (block == -1) {
-        prob_decrease = matrix_[macro][0].average();
+        prob_decrease = average(macro, 0);
       } else {
-        prob_decrease = matrix_[macro][0].blocks()[0][block];
+        prob_decrease = blocks_of_(macro, 0)[block];
       }
 //      if (block == -1) INFO("prob_decrease " << prob_decrease);
       if (prob_decrease == 0) {
@@ -96,9 +150,9 @@ void CollectionMatrix::compute_ln_prob(
       } else {
         double prob_increase;
         if (block == -1) {
-          prob_increase = matrix_[macro - 1][1].average();
+          prob_increase = average(macro - 1, 1);
         } else {
-          prob_increase = matrix_[macro - 1][1].blocks()[0][block];
+          prob_increase = blocks_of_(macro - 1, 1)[block];
         }
 //        if (block == -1) INFO("prob_increase " << prob_increase);
         if (prob_increase == 0) {
@@ -116,13 +170,40 @@ void CollectionMatrix::compute_ln_prob(
       }
     }
   }
-  ln_prob->normalize();
+  if (normalize) {
+    ln_prob->normalize();
+  }
 }
 
 void CollectionMatrix::increment(
     const int row,
     const int column,
     const double inc) {
+  if (compact_) {
+    const int index = 2*row + column;
+    ASSERT(index < static_cast<int>(sums_.size()),
+      "row: " << row << " column: " << column << " size: " << size());
+    sums_[index] += inc;
+    counts_[index] += 1.;
+    block_sums_[index] += inc;
+    block_counts_[index] += 1.;
+    if (block_counts_[index] == block_sizes_[index]) {
+      std::vector<double> * blocks = &blocks_[index];
+      blocks->push_back(static_cast<double>(
+        block_sums_[index]/block_sizes_[index]));
+      block_sums_[index] = 0.;
+      block_counts_[index] = 0.;
+      // merge neighboring blocks and double the block size
+      if (static_cast<int>(blocks->size()) == max_blocks_) {
+        for (int block = 0; block < max_blocks_/2; ++block) {
+          (*blocks)[block] = 0.5*((*blocks)[2*block] + (*blocks)[2*block + 1]);
+        }
+        blocks->resize(max_blocks_/2);
+        block_sizes_[index] *= 2.;
+      }
+    }
+    return;
+  }
   DEBUG("row " << row << " column " << column << " size " << matrix_.size());
   ASSERT(row < static_cast<int>(matrix_.size()),
     "row: " << row << "  size: " << matrix_.size());
@@ -132,25 +213,63 @@ void CollectionMatrix::increment(
 }
 
 void CollectionMatrix::serialize(std::ostream& ostr) const {
-  feasst_serialize_version(2468, ostr);
+  feasst_serialize_version(2469, ostr);
   feasst_serialize(delta_ln_prob_guess_, ostr);
   feasst_serialize(visits_per_delta_ln_prob_boost_, ostr);
   feasst_serialize(exp_for_boost_, ostr);
   feasst_serialize_fstobj(matrix_, ostr);
+  feasst_serialize(compact_, ostr);
+  if (compact_) {
+    feasst_serialize(max_blocks_, ostr);
+    feasst_serialize(sums_, ostr);
+    feasst_serialize(counts_, ostr);
+    feasst_serialize(block_sums_, ostr);
+    feasst_serialize(block_counts_, ostr);
+    feasst_serialize(block_sizes_, ostr);
+    feasst_serialize(blocks_, ostr);
+  }
 }
 
 CollectionMatrix::CollectionMatrix(std::istream& istr) {
   const int version = feasst_deserialize_version(istr);
-  ASSERT(version == 2468, "unrecognized verison: " << version);
+  ASSERT(version >= 2468 && version <= 2469,
+    "unrecognized verison: " << version);
   feasst_deserialize(&delta_ln_prob_guess_, istr);
   feasst_deserialize(&visits_per_delta_ln_prob_boost_, istr);
   feasst_deserialize(&exp_for_boost_, istr);
   feasst_deserialize_fstobj(&matrix_, istr);
+  max_blocks_ = 32;
+  if (version >= 2469) {
+    feasst_deserialize(&compact_, istr);
+    if (compact_) {
+      feasst_deserialize(&max_blocks_, istr);
+      feasst_deserialize(&sums_, istr);
+      feasst_deserialize(&counts_, istr);
+      feasst_deserialize(&block_sums_, istr);
+      feasst_deserialize(&block_counts_, istr);
+      feasst_deserialize(&block_sizes_, istr);
+      feasst_deserialize(&blocks_, istr);
+    }
+  }
 }
 
 bool CollectionMatrix::is_equal(
     const CollectionMatrix& colmat,
     const double tolerance) const {
+  if (compact_ != colmat.compact_) {
+    return false;
+  }
+  if (compact_) {
+    if (!feasst::is_equal(counts_, colmat.counts_)) {
+      return false;
+    }
+    for (int index = 0; index < static_cast<int>(sums_.size()); ++index) {
+      if (std::abs(sums_[index] - colmat.sums_[index]) > tolerance) {
+        return false;
+      }
+    }
+    return true;
+  }
   for (int row = 0; row < static_cast<int>(matrix_.size()); ++row) {
     for (int col = 0; col < static_cast<int>(matrix_[row].size()); ++col) {
       if (!matrix_[row][col].is_equal(colmat.matrix_[row][col], tolerance)) {
@@ -200,15 +319,25 @@ std::string CollectionMatrix::write_per_bin(const int bin) const {
     delta_ln_p.accumulate(ln_prob.delta(bin));
   }
   ss << delta_ln_p.stdev_of_av() << ",";
-  ss << MAX_PRECISION << matrix()[bin][0].average() << ","
-     << matrix()[bin][1].average() << ","
-     << matrix()[bin][0].moment(0) << ","
-     << matrix()[bin][0].block_stdev() << ","
-     << matrix()[bin][1].block_stdev();
+  ss << MAX_PRECISION << average(bin, 0) << ","
+     << average(bin, 1) << ","
+     << num_values(bin, 0) << ","
+     << block_stdev_(bin, 0) << ","
+     << block_stdev_(bin, 1);
   return ss.str();
 }
 
 void CollectionMatrix::resize(const int num_macrostates) {
+  if (compact_) {
+    const int num = 2*num_macrostates;
+    sums_.assign(num, 0.);
+    counts_.assign(num, 0.);
+    block_sums_.assign(num, 0.);
+    block_counts_.assign(num, 0.);
+    block_sizes_.assign(num, 1.);
+    blocks_.assign(num, std::vector<double>());
+    return;
+  }
   feasst::resize(num_macrostates, 2, &matrix_);
   for (auto& mat1 : matrix_) {
     for (auto& mat2 : mat1) {
@@ -218,12 +347,47 @@ void CollectionMatrix::resize(const int num_macrostates) {
 }
 
 void CollectionMatrix::set(const int macro, const std::vector<Accumulator>& values) {
+  ASSERT(!compact_, "not implemented in the compact mode");
   matrix_[macro] = values;
 }
 
+void CollectionMatrix::set(const int macro, const CollectionMatrix& cm) {
+  ASSERT(compact_ == cm.compact_, "mismatch of compact mode");
+  if (compact_) {
+    for (int index = 2*macro; index < 2*macro + 2; ++index) {
+      sums_[index] = cm.sums_[index];
+      counts_[index] = cm.counts_[index];
+      block_sums_[index] = cm.block_sums_[index];
+      block_counts_[index] = cm.block_counts_[index];
+      block_sizes_[index] = cm.block_sizes_[index];
+      blocks_[index] = cm.blocks_[index];
+    }
+  } else {
+    matrix_[macro] = cm.matrix_[macro];
+  }
+}
+
+void CollectionMatrix::set(const int macro, const int state_change,
+    const double average, const double num_values) {
+  ASSERT(compact_, "requires the compact mode");
+  const int index = 2*macro + state_change;
+  sums_[index] = average*num_values;
+  counts_[index] = num_values;
+}
+
 int CollectionMatrix::min_blocks() const {
   bool found = false;
   int min = 1e9;
+  if (compact_) {
+    for (const std::vector<double>& blocks : blocks_) {
+      const int num = static_cast<int>(blocks.size());
+      if (num > 0 && num < min) {
+        min = num;
+        found = true;
+      }
+    }
+    return found ? min : 0;
+  }
   for (const auto& mat1 : matrix_) {
     for (const auto& mat2 : mat1) {
       if (mat2.block_size().size() > 0) {
@@ -248,7 +412,7 @@ int CollectionMatrix::min_blocks() const {
 std::vector<LnProbability> CollectionMatrix::ln_prob_blocks() const {
   std::vector<LnProbability> ln_probs;
   LnProbability lnpi;
-  lnpi.resize(matrix().size());
+  lnpi.resize(size());
   for (int block = 0; block < min_blocks(); ++block) {
     compute_ln_prob(&lnpi, block);
     ln_probs.push_back(lnpi);
@@ -12,12 +12,14 @@
 #include "utils/include/debug.h"
 #include "utils/include/serialize.h"
 #include "utils/include/checkpoint.h"
+#include "utils/include/file.h"
 #include "math/include/constants.h"
 #include "math/include/histogram.h"
 #include "math/include/utils_math.h"
 #include "flat_histogram/include/flat_histogram.h"
 #include "flat_histogram/include/transition_matrix.h"
 #include "flat_histogram/include/wltm.h"
+#include "flat_histogram/include/shared_window.h"
 #include "flat_histogram/include/collection_matrix_splice.h"
 #include "monte_carlo/include/run.h"
 
@@ -30,6 +32,9 @@ CollectionMatrixSplice::CollectionMatrixSplice(argtype * args) {
   ln_prob_file_append_ = boolean("ln_prob_file_append", args, false);
   num_adjust_per_write_ = integer("num_adjust_per_write", args, 1);
   bounds_file_ = str("bounds_file", args, "");
+  balance_throughput_ = boolean("balance_throughput", args, false);
+  shared_file_ = str("shared_file", args, "");
+  timeout_hours_ = dble("timeout_hours", args, 1.);
 }
 CollectionMatrixSplice::CollectionMatrixSplice(argtype args) :
   CollectionMatrixSplice(&args) {
@@ -55,7 +60,7 @@ const FlatHistogram& CollectionMatrixSplice::flat_histogram(const int index) con
 }
 
 void CollectionMatrixSplice::serialize(std::ostream& ostr) const {
-  feasst_serialize_version(2974, ostr);
+  feasst_serialize_version(2977, ostr);
   feasst_serialize(clones_, ostr);
   feasst_serialize(min_window_size_, ostr);
   feasst_serialize(hours_per_, ostr);
@@ -65,12 +70,16 @@ void CollectionMatrixSplice::serialize(std::ostream& ostr) const {
   feasst_serialize(num_adjust_since_write_, ostr);
   feasst_serialize(bounds_file_, ostr);
   feasst_serialize(checkpoint_, ostr);
+  feasst_serialize(balance_throughput_, ostr);
+  feasst_serialize(trials_per_second_, ostr);
+  feasst_serialize(shared_file_, ostr);
+  feasst_serialize(timeout_hours_, ostr);
   feasst_serialize_endcap("CollectionMatrixSplice", ostr);
 }
 
 CollectionMatrixSplice::CollectionMatrixSplice(std::istream& istr) {
   const int version = feasst_deserialize_version(istr);
-  ASSERT(version == 2974, "version: " << version);
+  ASSERT(version >= 2974 && version <= 2977, "version: " << version);
   // HWH for unknown reasons, this does not work
   //feasst_deserialize(&clones_, istr);
   int dim1;
@@ -98,6 +107,18 @@ CollectionMatrixSplice::CollectionMatrixSplice(std::istream& istr) {
       checkpoint_ = std::make_shared<Checkpoint>(istr);
     }
   }
+  balance_throughput_ = false;
+  if (version >= 2975) {
+    feasst_deserialize(&balance_throughput_, istr);
+    feasst_deserialize(&trials_per_second_, istr);
+  }
+  if (version >= 2976) {
+    feasst_deserialize(&shared_file_, istr);
+  }
+  timeout_hours_ = 1.;
+  if (version >= 2977) {
+    feasst_deserialize(&timeout_hours_, istr);
+  }
   feasst_deserialize_endcap("CollectionMatrixSplice", istr);
 }
 
@@ -115,22 +136,51 @@ bool CollectionMatrixSplice::are_all_complete() const {
 }
 
 void CollectionMatrixSplice::run(const double hours) {
+  trials_per_second_.resize(num(), 0.);
   #ifdef _OPENMP
   #pragma omp parallel
   {
     const int thread = omp_get_thread_num();
     if (thread < num()) {
-      MakeRun({{"for_hours", str(hours)}})->run(clones_[thread].get());
+      run_and_measure_(thread, hours);
     }
   }
   #else // _OPENMP
-    for (auto clone : clones_) {
-       MakeRun({{"for_hours", str(hours)}})->run(clone.get());
+    for (int index = 0; index < num(); ++index) {
+      run_and_measure_(index, hours);
     }
   #endif // _OPENMP
 }
 
+void CollectionMatrixSplice::run_and_measure_(const int index,
+    const double hours) {
+  MonteCarlo * mc = clones_[index].get();
+  const int64_t first_trial = mc->trials().num_attempts();
+  const auto begin = std::chrono::steady_clock::now();
+  MakeRun({{"for_hours", str(hours)}})->run(mc);
+  const double seconds = std::chrono::duration<double>(
+    std::chrono::steady_clock::now() - begin).count();
+  if (seconds > 0) {
+    trials_per_second_[index] =
+      static_cast<double>(mc->trials().num_attempts() - first_trial)/seconds;
+  }
+}
+
+void CollectionMatrixSplice::set_trials_per_second(const int index,
+    const double rate) {
+  ASSERT(index < num(), "index: " << index << " >= num: " << num());
+  trials_per_second_.resize(num(), 0.);
+  trials_per_second_[index] = rate;
+}
+
 void CollectionMatrixSplice::write(const std::string& file_name) const {
+  if (!file_name.empty()) {
+    write_(file_name, collection_matrix());
+  }
+}
+
+void CollectionMatrixSplice::write_(const std::string& file_name,
+    const CollectionMatrix& cm) const {
   if (!file_name.empty()) {
     std::ofstream file;
     if (ln_prob_file_append_) {
@@ -141,9 +191,9 @@ void CollectionMatrixSplice::write(const std::string& file_name) const {
     }
     if (file.good()) {
       auto tm = MakeTransitionMatrix({{"min_sweeps", "0"}});
-      tm->set_cm(collection_matrix());
+      tm->set_cm(cm);
       file << "state," << tm->write_per_bin_header() << std::endl;
-      for (int bin = 0; bin < static_cast<int>(tm->collection().matrix().size()); ++bin) {
+      for (int bin = 0; bin < tm->collection().size(); ++bin) {
         file << bin << "," << tm->write_per_bin(bin) << std::endl;
       }
     }
@@ -152,13 +202,14 @@ void CollectionMatrixSplice::write(const std::string& file_name) const {
 
 void CollectionMatrixSplice::run_until_all_are_complete() {
   write_bounds(true);
+  trials_per_second_.resize(num(), 0.);
   #ifdef _OPENMP
   #pragma omp parallel
   {
     const int thread = omp_get_thread_num();
     while (!are_all_complete()) {
       if (thread < num()) {
-        MakeRun({{"for_hours", str(hours_per_)}})->run(clones_[thread].get());
+        run_and_measure_(thread, hours_per_);
       }
 
       #pragma omp barrier
@@ -191,8 +242,7 @@ const CollectionMatrix& CollectionMatrixSplice::collection_matrix(
 }
 
 CollectionMatrix CollectionMatrixSplice::collection_matrix() const {
-  const CollectionMatrix& cm = collection_matrix(0);
-  std::vector<std::vector<Accumulator> > data = cm.matrix();
+  CollectionMatrix data = collection_matrix(0);
   const FlatHistogram& fh0 = flat_histogram(0);
   int last_max = fh0.macrostate().soft_max();
   for (int cli = 1; cli < num(); ++cli) {
@@ -207,20 +257,309 @@ CollectionMatrix CollectionMatrixSplice::collection_matrix() const {
     }
     const CollectionMatrix& cmi = collection_matrix(cli);
     for (int bin = fh.macrostate().soft_min(); bin <= max_bin; ++bin) {
-      data[bin] = cmi.matrix()[bin];
+      data.set(bin, cmi);
     }
   }
-  return CollectionMatrix(data);
+  return data;
 }
 
 LnProbability CollectionMatrixSplice::ln_prob() const {
   CollectionMatrix cm = collection_matrix();
   LnProbability ln_prob;
-  ln_prob.resize(cm.matrix().size());
+  ln_prob.resize(cm.size());
   cm.compute_ln_prob(&ln_prob);
   return ln_prob;
 }
 
+// Return the estimated seconds per macrostate for a number of iterations
+// and trials per second.
+static double seconds_per_macrostate(const int num_iterations,
+    const int num_iterations_to_complete, const double trials_per_second) {
+  const int num_left = std::max(0, num_iterations_to_complete - num_iterations);
+  return static_cast<double>(num_left)/trials_per_second;
+}
+
+double CollectionMatrixSplice::seconds_per_macrostate_(const int index) const {
+  const Criteria& crit = clone(index).criteria();
+  return seconds_per_macrostate(crit.num_iterations(),
+    crit.num_iterations_to_complete(), trials_per_second_[index]);
+}
+
+int CollectionMatrixSplice::throughput_shift(const int lower_index) const {
+  const int upper_index = lower_index + 1;
+  ASSERT(upper_index < num(), "upper_index: " << upper_index << " >= num: "
+    << num());
+  ASSERT(static_cast<int>(trials_per_second_.size()) == num() &&
+    trials_per_second_[lower_index] > 0 && trials_per_second_[upper_index] > 0,
+    "trials per second not measured");
+  return throughput_shift_(
+    clone(lower_index).criteria().macrostate().num_macrostates_in_soft_range(),
+    clone(upper_index).criteria().macrostate().num_macrostates_in_soft_range(),
+    seconds_per_macrostate_(lower_index),
+    seconds_per_macrostate_(upper_index));
+}
+
+int CollectionMatrixSplice::throughput_shift_(int lower_size, int upper_size,
+    const double lower_seconds, const double upper_seconds) const {
+  int shift = 0;
+  for (int direction = 1; direction >= -1 && shift == 0; direction -= 2) {
+    while (true) {
+      const int new_lower = lower_size - direction;
+      const int new_upper = upper_size + direction;
+      if (new_lower < min_window_size_ || new_upper < min_window_size_) break;
+      const double time = std::max(lower_seconds*lower_size,
+                                   upper_seconds*upper_size);
+      const double new_time = std::max(lower_seconds*new_lower,
+                                       upper_seconds*new_upper);
+      if (new_time >= time) break;
+      lower_size = new_lower;
+      upper_size = new_upper;
+      shift += direction;
+    }
+  }
+  return shift;
+}
+
+SharedWindow * CollectionMatrixSplice::shared_(const int index) {
+  ASSERT(!shared_file_.empty(), "requires shared_file");
+  if (static_cast<int>(shared_windows_.size()) != num()) {
+    shared_windows_.resize(num());
+  }
+  if (!shared_windows_[index]) {
+    shared_windows_[index] = std::make_shared<SharedWindow>(
+      shared_file_ + sized_int_to_str(index, num()));
+  }
+  return shared_windows_[index].get();
+}
+
+void CollectionMatrixSplice::publish(const int index) {
+  double rate = 0.;
+  if (index < static_cast<int>(trials_per_second_.size())) {
+    rate = trials_per_second_[index];
+  }
+  shared_(index)->write(clone(index).criteria().flat_histogram(), rate);
+}
+
+void CollectionMatrixSplice::run_window(const int index) {
+  ASSERT(index < num(), "index: " << index << " >= num: " << num());
+  ASSERT(clones_[index], "window: " << index << " was not set");
+  if (min_window_size_ > 0) {
+    check_not_multistate_(index);
+  }
+  trials_per_second_.resize(num(), 0.);
+  while (!clones_[index]->criteria().is_complete()) {
+    run_and_measure_(index, hours_per_);
+    publish(index);
+    apply_requested_bounds(index);
+    if (checkpoint_) {
+      checkpoint_->check(*clones_[index]);
+    }
+  }
+  publish(index);
+  clones_[index]->write_to_file();
+}
+
+bool CollectionMatrixSplice::read_published() {
+  for (int index = 0; index < num(); ++index) {
+    if (!shared_(index)->read()) {
+      return false;
+    }
+  }
+  return true;
+}
+
+CollectionMatrix CollectionMatrixSplice::published_collection_matrix() {
+  ASSERT(read_published(), "not all windows have been published");
+  CollectionMatrix data = shared_(0)->bias().cm();
+  const int size = data.size();
+  for (int bin = 0; bin < size; ++bin) {
+    // While bounds are adjusted, a macrostate may be in two windows.
+    // Use the window with the most values, as the other is a copy.
+    int window = -1;
+    double most_values = -1.;
+    for (int index = 0; index < num(); ++index) {
+      const SharedWindow& shared = *shared_(index);
+      ASSERT(shared.bias().cm().size() == size, "size mismatch");
+      int min_bin = shared.soft_min();
+      int max_bin = shared.soft_max();
+      if (index == 0) min_bin = 0;
+      if (index == num() - 1) max_bin = size - 1;
+      if (bin >= min_bin && bin <= max_bin) {
+        const CollectionMatrix& cm = shared.bias().cm();
+        const double values = cm.num_values(bin, 0) + cm.num_values(bin, 1);
+        if (values > most_values) {
+          most_values = values;
+          window = index;
+        }
+      }
+    }
+    ASSERT(window != -1, "macrostate: " << bin << " is not in any window");
+    if (window != 0) {
+      data.set(bin, shared_(window)->bias().cm());
+    }
+  }
+  return data;
+}
+
+void CollectionMatrixSplice::adjust_published_bounds() {
+  if (min_window_size_ <= 0 || !read_published()) return;
+  // begin with the previous requests, or the published bounds if none
+  std::vector<int> req_min(num()), req_max(num());
+  for (int index = 0; index < num(); ++index) {
+    const SharedWindow& shared = *shared_(index);
+    if (!shared.requested_bounds(&req_min[index], &req_max[index])) {
+      req_min[index] = shared.soft_min();
+      req_max[index] = shared.soft_max();
+    }
+  }
+  std::vector<int> new_min = req_min, new_max = req_max;
+  for (int lower = 0; lower < num() - 1; ++lower) {
+    const SharedWindow& low = *shared_(lower);
+    const SharedWindow& up = *shared_(lower + 1);
+    // wait for the previous request of this boundary, and completed windows
+    // no longer run
+    if (low.soft_max() != req_max[lower] ||
+        up.soft_min() != req_min[lower + 1] ||
+        low.soft_max() + 1 != up.soft_min() ||
+        low.is_complete() || up.is_complete()) {
+      continue;
+    }
+    const int lower_size = new_max[lower] - new_min[lower] + 1;
+    const int upper_size = new_max[lower + 1] - new_min[lower + 1] + 1;
+    int shift = 0;
+    if (balance_throughput_ && low.trials_per_second() > 0 &&
+        up.trials_per_second() > 0) {
+      shift = throughput_shift_(lower_size, upper_size,
+        seconds_per_macrostate(low.num_iterations(),
+          low.num_iterations_to_complete(), low.trials_per_second()),
+        seconds_per_macrostate(up.num_iterations(),
+          up.num_iterations_to_complete(), up.trials_per_second()));
+    } else if (low.num_iterations() < up.num_iterations()) {
+      if (lower_size > min_window_size_) shift = 1;
+    } else if (low.num_iterations() > up.num_iterations()) {
+      if (upper_size > min_window_size_) shift = -1;
+    }
+    new_max[lower] -= shift;
+    new_min[lower + 1] -= shift;
+  }
+  for (int index = 0; index < num(); ++index) {
+    if (new_min[index] != req_min[index] || new_max[index] != req_max[index]) {
+      shared_(index)->request_bounds(new_min[index], new_max[index]);
+    }
+  }
+}
+
+// The data of multistate Analyze and Modify in other processes is not
+// available to move with the macrostates.
+void CollectionMatrixSplice::check_not_multistate_(const int index) const {
+  const MonteCarlo& mc = *clones_[index];
+  for (int an = 0; an < mc.num_analyzers(); ++an) {
+    ASSERT(!mc.analyze(an).is_multistate(), "multistate "
+      << mc.analyze(an).class_name() << " is not implemented for windows in "
+      << "separate processes with adjusted bounds");
+  }
+  for (int mo = 0; mo < mc.num_modifiers(); ++mo) {
+    ASSERT(!mc.modify(mo).is_multistate(), "multistate "
+      << mc.modify(mo).class_name() << " is not implemented for windows in "
+      << "separate processes with adjusted bounds");
+  }
+}
+
+void CollectionMatrixSplice::apply_requested_bounds(const int index) {
+  int min, max;
+  if (!shared_(index)->requested_bounds(&min, &max)) return;
+  check_not_multistate_(index);
+  FlatHistogram * fh = dynamic_cast<FlatHistogram*>(
+    clones_[index]->get_criteria());
+  ASSERT(fh, "requires FlatHistogram");
+  if (!fh->bias().is_adjust_allowed(fh->macrostate())) return;
+  const System& system = clones_[index]->system();
+  SharedWindow * lower = NULL;
+  SharedWindow * upper = NULL;
+  if (index > 0 && shared_(index - 1)->read()) lower = shared_(index - 1);
+  if (index < num() - 1 && shared_(index + 1)->read()) {
+    upper = shared_(index + 1);
+  }
+  bool changed = false;
+
+  // grow into macrostates sampled by a neighbor, and copy them
+  while (lower && fh->soft_min() > min &&
+         fh->soft_min() - 1 >= lower->soft_min() &&
+         fh->soft_min() - 1 <= lower->soft_max()) {
+    fh->set_cm(false, fh->soft_min() - 1, lower->bias());
+    changed = true;
+  }
+  while (upper && fh->soft_max() < max &&
+         fh->soft_max() + 1 <= upper->soft_max() &&
+         fh->soft_max() + 1 >= upper->soft_min()) {
+    fh->set_cm(true, fh->soft_max() + 1, upper->bias());
+    changed = true;
+  }
+
+  // give up macrostates only once a neighbor has published that it samples
+  // them
+  while (lower && fh->soft_min() < min &&
+         fh->soft_min() <= lower->soft_max() &&
+         fh->set_soft_min(fh->soft_min() + 1, system) > 0) {
+    changed = true;
+  }
+  while (upper && fh->soft_max() > max &&
+         fh->soft_max() >= upper->soft_min() &&
+         fh->set_soft_max(fh->soft_max() - 1, system) > 0) {
+    changed = true;
+  }
+  if (changed) {
+    fh->update();
+    publish(index);
+  }
+}
+
+void CollectionMatrixSplice::coordinate() {
+  write_bounds(true);
+  const double begin = SharedWindow::seconds_since_epoch();
+  bool all_complete = false;
+  while (!all_complete) {
+    std::this_thread::sleep_for(std::chrono::duration<double>(3600.*hours_per_));
+    const double now = SharedWindow::seconds_since_epoch();
+    bool is_published = true;
+    for (int index = 0; index < num(); ++index) {
+      SharedWindow * shared = shared_(index);
+      double last = begin;
+      if (shared->read()) {
+        last = shared->is_complete() ? now : shared->seconds();
+      } else {
+        is_published = false;
+      }
+      ASSERT(timeout_hours_ <= 0 || now - last < 3600.*timeout_hours_,
+        "window: " << index << " has not published to "
+        << shared->file_name() << " for " << (now - last)/3600.
+        << " hours, which exceeds timeout_hours: " << timeout_hours_
+        << ". Its process may have terminated.");
+    }
+    if (is_published) {
+      all_complete = true;
+      std::vector<int> soft_min, soft_max;
+      trials_per_second_.resize(num());
+      for (int index = 0; index < num(); ++index) {
+        const SharedWindow& shared = *shared_(index);
+        if (!shared.is_complete()) all_complete = false;
+        soft_min.push_back(shared.soft_min());
+        soft_max.push_back(shared.soft_max());
+        trials_per_second_[index] = shared.trials_per_second();
+      }
+      ++num_adjust_since_write_;
+      if (num_adjust_since_write_ >= num_adjust_per_write_ || all_complete) {
+        write_(ln_prob_file_, published_collection_matrix());
+        num_adjust_since_write_ = 0;
+      }
+      write_bounds_(soft_min, soft_max);
+      if (!all_complete) {
+        adjust_published_bounds();
+      }
+    }
+  }
+}
+
 // HWH enable adjusting bounds of a single simulation
 void CollectionMatrixSplice::adjust_bounds() {
   if (min_window_size_ <= 0) return;
@@ -262,8 +601,24 @@ void CollectionMatrixSplice::adjust_bounds() {
 //          right_complete = false;
 //        }
 //      }
-      clones_[sim]->adjust_bounds(left_most, right_most, left_complete, right_complete, all_min_size, min_window_size_,
-                                  clones_[sim + 1].get());
+      bool measured = false;
+      if (balance_throughput_) {
+        measured = static_cast<int>(trials_per_second_.size()) == num();
+        if (measured) {
+          for (const double rate : trials_per_second_) {
+            if (rate <= 0) measured = false;
+          }
+        }
+      }
+      if (measured) {
+        const int shift = throughput_shift(sim);
+        DEBUG("shift " << shift);
+        clones_[sim]->shift_bounds(left_most, right_most, all_min_size,
+          min_window_size_, clones_[sim + 1].get(), shift);
+      } else {
+        clones_[sim]->adjust_bounds(left_most, right_most, left_complete, right_complete, all_min_size, min_window_size_,
+                                    clones_[sim + 1].get());
+      }
       left_most = false;
     }
   }
@@ -277,20 +632,47 @@ void CollectionMatrixSplice::write_bounds(const bool header) {
       for (int icl = 0; icl < num(); ++icl) {
         file << "min" << icl << ",";
       }
-      file << "max" << num() - 1 << ",cpuhours" << std::endl;
+      file << "max" << num() - 1 << ",cpuhours";
+      if (is_rate_written_()) {
+        for (int icl = 0; icl < num(); ++icl) {
+          file << ",rate" << icl;
+        }
+      }
+      file << std::endl;
     } else {
+      std::vector<int> soft_min, soft_max;
+      for (int icl = 0; icl < num(); ++icl) {
+        soft_min.push_back(clones_[icl]->criteria().macrostate().soft_min());
+        soft_max.push_back(clones_[icl]->criteria().macrostate().soft_max());
+      }
+      write_bounds_(soft_min, soft_max);
+    }
+  }
+}
+
+void CollectionMatrixSplice::write_bounds_(const std::vector<int>& soft_min,
+    const std::vector<int>& soft_max) const {
+  if (!bounds_file_.empty()) {
+    {
       std::ofstream file(bounds_file_, std::ofstream::out | std::ofstream::app);
       for (int icl = 0; icl < num(); ++icl) {
-        file << clones_[icl]->criteria().macrostate().soft_min() << ",";
+        file << soft_min[icl] << ",";
         if (icl == num() - 1) {
-          file << clones_[icl]->criteria().macrostate().soft_max() << ",";
+          file << soft_max[icl] << ",";
         } else {
-          ASSERT(clones_[icl]->criteria().macrostate().soft_max() + 1 ==
-               clones_[1+icl]->criteria().macrostate().soft_min(),
-               "error");
+          ASSERT(soft_max[icl] + 1 == soft_min[1+icl], "error");
+        }
+      }
+      file << cpu_hours();
+      if (is_rate_written_()) {
+        for (int icl = 0; icl < num(); ++icl) {
+          file << ",";
+          if (icl < static_cast<int>(trials_per_second_.size())) {
+            file << trials_per_second_[icl];
+          }
         }
       }
-      file << cpu_hours() << std::endl;
+      file << std::endl;
     }
   }
 }
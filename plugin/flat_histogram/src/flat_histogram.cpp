@@ -1,4 +1,5 @@
 #include <cmath>
+#include <chrono>
 #include "utils/include/serialize.h"
 #include "math/include/constants.h"
 #include "math/include/random.h"
@@ -106,6 +107,7 @@ std::string FlatHistogram::write() const {
   ss << "#";
   ss << Criteria::write();
   ss << bias_->write();
+  ss << "\"bias_update_hours\":" << bias_update_hours_ << ",";
   ss << "\"soft_min\":" << macrostate_->soft_min() << ","
      << "\"soft_max\":" << macrostate_->soft_max();
   ss << std::endl;
@@ -124,6 +126,14 @@ std::string FlatHistogram::write() const {
   return ss.str();
 }
 
+void FlatHistogram::update() {
+  const std::chrono::steady_clock::time_point begin =
+    std::chrono::steady_clock::now();
+  bias_->infrequent_update(*macrostate_);
+  bias_update_hours_ += std::chrono::duration<double>(
+    std::chrono::steady_clock::now() - begin).count()/60./60.;
+}
+
 void FlatHistogram::finalize(const Acceptance& acceptance) {
   DEBUG("macrostate_old_, " << macrostate_old_);
   DEBUG("macrostate_new_, " << macrostate_new_);
@@ -173,7 +183,7 @@ static MapFlatHistogram mapper_ = MapFlatHistogram();
 FlatHistogram::FlatHistogram(std::istream& istr)
   : Criteria(istr) {
   const int version = feasst_deserialize_version(istr);
-  ASSERT(version == 6079, "version mismatch: " << version);
+  ASSERT(version >= 6079 && version <= 6080, "version mismatch: " << version);
   // feasst_deserialize_fstdr(bias_, istr);
   { // HWH for unknown reasons the above template function does not work
     int existing;
@@ -194,18 +204,22 @@ FlatHistogram::FlatHistogram(std::istream& istr)
   feasst_deserialize(&macrostate_new_, istr);
   feasst_deserialize(&macrostate_current_, istr);
   feasst_deserialize(&is_macrostate_set_, istr);
+  if (version >= 6080) {
+    feasst_deserialize(&bias_update_hours_, istr);
+  }
 }
 
 void FlatHistogram::serialize(std::ostream& ostr) const {
   ostr << class_name_ << " ";
   serialize_criteria_(ostr);
-  feasst_serialize_version(6079, ostr);
+  feasst_serialize_version(6080, ostr);
   feasst_serialize_fstdr(bias_, ostr);
   feasst_serialize_fstdr(macrostate_, ostr);
   feasst_serialize(macrostate_old_, ostr);
   feasst_serialize(macrostate_new_, ostr);
   feasst_serialize(macrostate_current_, ostr);
   feasst_serialize(is_macrostate_set_, ostr);
+  feasst_serialize(bias_update_hours_, ostr);
 }
 
 void FlatHistogram::before_attempt(const System& system) {
@@ -249,12 +263,16 @@ int FlatHistogram::set_soft_min(const int index, const System& sys) {
 }
 
 void FlatHistogram::set_cm(const bool inc_max, const int macro, const Criteria& crit) {
+  set_cm(inc_max, macro, crit.bias());
+}
+
+void FlatHistogram::set_cm(const bool inc_max, const int macro, const Bias& bias) {
   if (inc_max) {
     macrostate_->add_to_soft_max(1);
   } else {
     macrostate_->remove_from_soft_min(1);
   }
-  bias_->set_cm(macro, crit.bias());
+  bias_->set_cm(macro, bias);
 }
 
 void FlatHistogram::check_left_and_right_most_(const bool left_most, const bool right_most,
@@ -312,6 +330,38 @@ void FlatHistogram::check_left_and_right_most_(const bool left_most, const bool
     }
   }
 }
+bool FlatHistogram::move_macrostate_up_(const int min_size,
+    const System& system, Criteria * criteria, std::vector<int> * states) {
+  const int lower_max = macrostate().soft_max();
+  if (lower_max - macrostate().soft_min() + 1 > min_size) {
+    DEBUG("move macrostate from lower to upper");
+    if (set_soft_max(lower_max - 1, system) > 0) {
+      criteria->set_cm(false, lower_max, *this);
+      states->push_back(lower_max);
+      update();
+      criteria->update();
+      return true;
+    }
+  }
+  return false;
+}
+
+bool FlatHistogram::move_macrostate_down_(const int min_size,
+    const System& upper_sys, Criteria * criteria, std::vector<int> * states) {
+  const int upper_min = criteria->macrostate().soft_min();
+  if (criteria->macrostate().soft_max() - upper_min + 1 > min_size) {
+    DEBUG("move macrostate from upper to lower");
+    if (criteria->set_soft_min(upper_min + 1, upper_sys) > 0) {
+      set_cm(true, upper_min, *criteria);
+      states->push_back(upper_min);
+      update();
+      criteria->update();
+      return true;
+    }
+  }
+  return false;
+}
+
 void FlatHistogram::adjust_bounds(const bool left_most, const bool right_most,
   const bool left_complete, const bool right_complete,
   const bool all_min_size,
@@ -325,45 +375,22 @@ void FlatHistogram::adjust_bounds(const bool left_most, const bool right_most,
     bool not_reject = true;
     while (not_reject) {
       not_reject = false;
-      const int lower_max = macrostate().soft_max();
       // if its left_most and already finished, don't send macrostates to upper
       if (num_iterations() < criteria->num_iterations()) {
 //      && (!left_most || right_complete || all_min_size || num_iterations() < num_iterations_to_complete())) {
-        if (lower_max - macrostate().soft_min() + 1 > min_size) {
-          DEBUG("move macrostate from lower to upper");
-          if (set_soft_max(lower_max - 1, system) > 0) {
-            criteria->set_cm(false, lower_max, *this);
-            not_reject = true;
-            *adjusted_up = true;
-            states->push_back(lower_max);
-          }
-        }
-      }
-      if (not_reject) {
-        update();
-        criteria->update();
+        not_reject = move_macrostate_up_(min_size, system, criteria, states);
+        if (not_reject) *adjusted_up = true;
       }
     }
     DEBUG("adjusted_up " << *adjusted_up);
     not_reject = true;
     while (not_reject && !*adjusted_up) {
       not_reject = false;
-      const int upper_min = criteria->macrostate().soft_min();
       // if its right_most and already finished, don't send macrostates to lower
       if (num_iterations() > criteria->num_iterations()) {
 //      && (!right_most || left_complete || all_min_size || criteria->num_iterations() < criteria->num_iterations_to_complete())) {
-        if (criteria->macrostate().soft_max() - upper_min + 1 > min_size) {
-          DEBUG("move macrostate from upper to lower");
-          if (criteria->set_soft_min(upper_min + 1, *upper_sys) > 0) {
-            set_cm(true, upper_min, *criteria);
-            not_reject = true;
-            states->push_back(upper_min);
-          }
-        }
-      }
-      if (not_reject) {
-        update();
-        criteria->update();
+        not_reject = move_macrostate_down_(min_size, *upper_sys, criteria,
+                                           states);
       }
     }
     DEBUG("states: " << feasst_str(*states));
@@ -371,6 +398,27 @@ void FlatHistogram::adjust_bounds(const bool left_most, const bool right_most,
   check_left_and_right_most_(left_most, right_most, all_min_size, min_size, system, upper_sys, criteria);
 }
 
+void FlatHistogram::shift_bounds(const bool left_most, const bool right_most,
+  const bool all_min_size,
+  const int min_size, const System& system, const System& upper_sys,
+  Criteria * criteria, bool * adjusted_up, std::vector<int> * states,
+  const int shift) {
+  DEBUG("shift " << shift);
+  check_left_and_right_most_(left_most, right_most, all_min_size, min_size, system, &upper_sys, criteria);
+  *adjusted_up = false;
+  bool not_reject = true;
+  while (not_reject && static_cast<int>(states->size()) < shift) {
+    not_reject = move_macrostate_up_(min_size, system, criteria, states);
+    if (not_reject) *adjusted_up = true;
+  }
+  not_reject = true;
+  while (not_reject && static_cast<int>(states->size()) < -shift) {
+    not_reject = move_macrostate_down_(min_size, upper_sys, criteria, states);
+  }
+  DEBUG("states: " << feasst_str(*states));
+  check_left_and_right_most_(left_most, right_most, all_min_size, min_size, system, &upper_sys, criteria);
+}
+
 int FlatHistogram::soft_min() const { return macrostate_->soft_min(); }
 int FlatHistogram::soft_max() const { return macrostate_->soft_max(); }
 
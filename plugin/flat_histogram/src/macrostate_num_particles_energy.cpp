@@ -0,0 +1,114 @@
+#include "utils/include/serialize.h"
+#include "flat_histogram/include/macrostate_num_particles_energy.h"
+
+namespace feasst {
+
+namespace {
+
+Histogram flattened_histogram(const Histogram& num_particles,
+    const Histogram& energy) {
+  return Histogram({{"width", "1"},
+    {"max", str(num_particles.size()*energy.size() - 1)}});
+}
+
+Histogram energy_histogram(argtype * args) {
+  return Histogram({{"width", str("energy_width", args)},
+                    {"max", str("energy_max", args)},
+                    {"min", str("energy_min", args)}});
+}
+
+}  // namespace
+
+MacrostateNumParticlesEnergy::MacrostateNumParticlesEnergy(
+    const Histogram& num_particles,
+    const Histogram& energy,
+    argtype * args)
+  : Macrostate(flattened_histogram(num_particles, energy), args) {
+  class_name_ = "MacrostateNumParticlesEnergy";
+  num_ = ConstrainNumParticles(
+    {{"type", str("particle_type", args, "-1")}});
+  ASSERT(num_.type() >= -1, "particle_type: " << num_.type());
+  num_particles_ = num_particles;
+  energy_ = energy;
+  ASSERT(soft_min() == 0 && soft_max() == histogram().size() - 1,
+    "MacrostateNumParticlesEnergy does not support soft limits");
+}
+MacrostateNumParticlesEnergy::MacrostateNumParticlesEnergy(
+    const Histogram& num_particles,
+    const Histogram& energy,
+    argtype args)
+  : MacrostateNumParticlesEnergy(num_particles, energy, &args) {
+  FEASST_CHECK_ALL_USED(args);
+}
+MacrostateNumParticlesEnergy::MacrostateNumParticlesEnergy(argtype * args)
+  : MacrostateNumParticlesEnergy(Histogram(args), energy_histogram(args),
+                                 args) {}
+MacrostateNumParticlesEnergy::MacrostateNumParticlesEnergy(argtype args)
+  : MacrostateNumParticlesEnergy(&args) {
+  FEASST_CHECK_ALL_USED(args);
+}
+
+std::shared_ptr<Macrostate> MacrostateNumParticlesEnergy::create(
+    argtype * args) const {
+  return std::make_shared<MacrostateNumParticlesEnergy>(args);
+}
+
+double MacrostateNumParticlesEnergy::value(const System& system,
+    const Criteria& criteria,
+    const Acceptance& acceptance) const {
+  const double num = num_.num_particles(system, acceptance);
+  double en = criteria.current_energy();
+  if (acceptance.updated() == 1) {
+    en = acceptance.energy_new();
+  }
+  if (num < num_particles_.min() || num > num_particles_.max() ||
+      en < energy_.min() || en > energy_.max()) {
+    return -1;
+  }
+  return num_particles_.bin(num)*energy_.size() + energy_.bin(en);
+}
+
+double MacrostateNumParticlesEnergy::num_particles(const int bin) const {
+  return num_particles_.center_of_bin(bin/energy_.size());
+}
+
+double MacrostateNumParticlesEnergy::energy(const int bin) const {
+  return energy_.center_of_bin(bin % energy_.size());
+}
+
+class MapMacrostateNumParticlesEnergy {
+ public:
+  MapMacrostateNumParticlesEnergy() {
+    auto hist = MakeHistogram({{"width", "1"}, {"max", "1"}});
+    auto obj = MakeMacrostateNumParticlesEnergy(*hist, *hist);
+    obj->deserialize_map()["MacrostateNumParticlesEnergy"] = obj;
+  }
+};
+
+static MapMacrostateNumParticlesEnergy mapper_ =
+  MapMacrostateNumParticlesEnergy();
+
+std::shared_ptr<Macrostate> MacrostateNumParticlesEnergy::create(
+    std::istream& istr) const {
+  return std::make_shared<MacrostateNumParticlesEnergy>(istr);
+}
+
+MacrostateNumParticlesEnergy::MacrostateNumParticlesEnergy(std::istream& istr)
+  : Macrostate(istr) {
+  const int version = feasst_deserialize_version(istr);
+  ASSERT(version == 5813, "version mismatch: " << version);
+  feasst_deserialize_fstobj(&num_, istr);
+  feasst_deserialize_fstobj(&num_particles_, istr);
+  feasst_deserialize_fstobj(&energy_, istr);
+}
+
+void MacrostateNumParticlesEnergy::serialize(std::ostream& ostr) const {
+  ostr << class_name_ << " ";
+  serialize_macrostate_(ostr);
+  feasst_serialize_version(5813, ostr);
+  feasst_serialize_fstobj(num_, ostr);
+  feasst_serialize_fstobj(num_particles_, ostr);
+  feasst_serialize_fstobj(energy_, ostr);
+}
+
+}  // namespace feasst
@@ -0,0 +1,92 @@
+#include <cstdio>         // std::rename
+#include <fstream>
+#include <sstream>
+#include <chrono>
+#include "utils/include/debug.h"
+#include "utils/include/serialize.h"
+#include "flat_histogram/include/bias.h"
+#include "flat_histogram/include/flat_histogram.h"
+#include "flat_histogram/include/shared_window.h"
+
+namespace feasst {
+
+SharedWindow::SharedWindow(const std::string& file_name) {
+  file_name_ = file_name;
+  ASSERT(!file_name_.empty(), "file_name is required");
+}
+
+double SharedWindow::seconds_since_epoch() {
+  return std::chrono::duration<double>(
+    std::chrono::system_clock::now().time_since_epoch()).count();
+}
+
+// Write to a temporary file and then rename, so that readers never see a
+// partial file.
+static void write_and_rename_(const std::string& file_name,
+    const std::string& contents) {
+  const std::string tmp_name = file_name + ".tmp";
+  std::ofstream file(tmp_name, std::ofstream::out | std::ofstream::trunc);
+  ASSERT(file.good(), "cannot open: " << tmp_name);
+  file << contents;
+  file.close();
+  ASSERT(std::rename(tmp_name.c_str(), file_name.c_str()) == 0,
+    "cannot rename: " << tmp_name << " to " << file_name);
+}
+
+void SharedWindow::write(const FlatHistogram& flat_histogram,
+    const double trials_per_second) {
+  std::stringstream ss;
+  feasst_serialize_version(8715, ss);
+  feasst_serialize(flat_histogram.macrostate().soft_min(), ss);
+  feasst_serialize(flat_histogram.macrostate().soft_max(), ss);
+  feasst_serialize(flat_histogram.num_iterations(), ss);
+  feasst_serialize(flat_histogram.num_iterations_to_complete(), ss);
+  feasst_serialize(flat_histogram.is_complete(), ss);
+  feasst_serialize(trials_per_second, ss);
+  feasst_serialize(seconds_since_epoch(), ss);
+  flat_histogram.bias().serialize(ss);
+  feasst_serialize_endcap("SharedWindow", ss);
+  write_and_rename_(file_name_, ss.str());
+}
+
+bool SharedWindow::read() {
+  std::ifstream file(file_name_);
+  if (!file.good()) {
+    return false;
+  }
+  const int version = feasst_deserialize_version(file);
+  ASSERT(version == 8715, "version mismatch: " << version);
+  feasst_deserialize(&soft_min_, file);
+  feasst_deserialize(&soft_max_, file);
+  feasst_deserialize(&num_iterations_, file);
+  feasst_deserialize(&num_iterations_to_complete_, file);
+  feasst_deserialize(&is_complete_, file);
+  feasst_deserialize(&trials_per_second_, file);
+  feasst_deserialize(&seconds_, file);
+  bias_ = bias_->deserialize(file);
+  feasst_deserialize_endcap("SharedWindow", file);
+  return true;
+}
+
+const Bias& SharedWindow::bias() const {
+  ASSERT(bias_, "file: " << file_name_ << " has not been read");
+  return *bias_;
+}
+
+void SharedWindow::request_bounds(const int soft_min,
+    const int soft_max) const {
+  std::stringstream ss;
+  ss << soft_min << " " << soft_max << std::endl;
+  write_and_rename_(file_name_ + "_bounds", ss.str());
+}
+
+bool SharedWindow::requested_bounds(int * soft_min, int * soft_max) const {
+  std::ifstream file(file_name_ + "_bounds");
+  if (!file.good()) {
+    return false;
+  }
+  file >> *soft_min >> *soft_max;
+  return !file.fail();
+}
+
+}  // namespace feasst
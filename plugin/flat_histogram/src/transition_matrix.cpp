@@ -38,6 +38,7 @@ void TransitionMatrix::update(
   DEBUG("is_endpoint " << is_endpoint);
   const int index = macrostate_new - macrostate_old + 1;
   ASSERT(index >= 0 and index <= 2, "index(" << index << ") must be 0, 1 or 2");
+  begin_ = std::min(begin_, macrostate_old - 1);
   if (is_accepted && (macrostate_old != macrostate_new)) {
     int vindex = 0;
     if (macrostate_old < macrostate_new) {
@@ -70,6 +71,7 @@ void TransitionMatrix::update(
 }
 
 void TransitionMatrix::resize(const int size) {
+  begin_ = 0;
   ln_prob_.resize(size);
   feasst::resize(size, 2, &visits_);
   collection_.resize(size);
@@ -114,7 +116,11 @@ int TransitionMatrix::min_vis_calc_(const Macrostate& macro) const {
 void TransitionMatrix::infrequent_update(const Macrostate& macro) {
   DEBUG("TransitionMatrix::infrequent_update_()");
   DEBUG("update the macrostate distribution");
-  collection_.compute_ln_prob(&ln_prob_);
+  if (begin_ < ln_prob_.size()) {
+    collection_.compute_ln_prob(&ln_prob_, -1, begin_, false);
+    begin_ = ln_prob_.size();
+    is_normalized_ = false;
+  }
 
   DEBUG("update the number of sweeps");
   if (new_sweep_ == 0) {
@@ -148,6 +154,16 @@ void TransitionMatrix::set_ln_prob(
   ASSERT(ln_prob.size() == ln_prob_.size(), "size mismatch: " <<
     ln_prob.size() << " " << ln_prob_.size());
   ln_prob_ = ln_prob;
+  begin_ = 0;
+  is_normalized_ = true;
+}
+
+const LnProbability& TransitionMatrix::ln_prob() const {
+  if (!is_normalized_) {
+    ln_prob_.normalize();
+    is_normalized_ = true;
+  }
+  return ln_prob_;
 }
 
 class MapTransitionMatrix {
@@ -196,7 +212,7 @@ void TransitionMatrix::serialize(std::ostream& ostr) const {
   ostr << class_name_ << " ";
   serialize_bias_(ostr);
   feasst_serialize_version(669, ostr);
-  feasst_serialize_fstobj(ln_prob_, ostr);
+  feasst_serialize_fstobj(ln_prob(), ostr);
   feasst_serialize_fstobj(collection_, ostr);
   feasst_serialize(visits_, ostr);
   feasst_serialize(min_visits_, ostr);
@@ -212,7 +228,7 @@ bool TransitionMatrix::is_equal(const TransitionMatrix& transition_matrix,
   if (!collection_.is_equal(transition_matrix.collection_, tolerance)) {
     return false;
   }
-  if (!ln_prob_.is_equal(transition_matrix.ln_prob_, tolerance)) {
+  if (!ln_prob().is_equal(transition_matrix.ln_prob(), tolerance)) {
     return false;
   }
   if (!feasst::is_equal(visits_, transition_matrix.visits_)) {
@@ -241,17 +257,20 @@ TransitionMatrix::TransitionMatrix(const Bias& bias) {
 }
 
 void TransitionMatrix::set_cm(const int macro, const Bias& bias) {
-  collection_.set(macro, bias.cm().matrix()[macro]);
+  collection_.set(macro, bias.cm());
+  begin_ = std::min(begin_, macro - 1);
   visits_[macro][0] = bias.visits(macro, 0);
   visits_[macro][1] = bias.visits(macro, 1);
 }
 
 void TransitionMatrix::set_cm(const CollectionMatrix& cm) {
   collection_ = cm;
-  const int size = collection_.matrix().size();
+  const int size = collection_.size();
   ln_prob_.resize(size);
   feasst::resize(size, 2, &visits_);
   collection_.compute_ln_prob(&ln_prob_);
+  begin_ = size;
+  is_normalized_ = true;
 }
 
 int TransitionMatrix::num_iterations(const int state, const Macrostate& macro) const {
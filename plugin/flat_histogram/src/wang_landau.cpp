@@ -18,12 +18,15 @@ WangLandau::WangLandau(argtype * args) {
   add_to_ln_probability_ = dble("add_to_ln_probability", args, 1.);
   reduce_ln_probability_ = dble("reduce_ln_probability", args, 0.5);
   min_visit_per_macro_ = integer("min_visit_per_macro", args, 1e3);
+  one_over_t_ = boolean("one_over_t", args, false);
 }
 
 void WangLandau::flatness_update_() {
   DEBUG(feasst_str(visited_states_));
   std::fill(visited_states_.begin(), visited_states_.end(), 0);
-  add_to_ln_probability_ *= reduce_ln_probability_;
+  if (is_one_over_t_ == 0) {
+    add_to_ln_probability_ *= reduce_ln_probability_;
+  }
   DEBUG("add_to_ln_probability_ " << add_to_ln_probability_);
   ++num_flatness_;
   ln_prob_.normalize();
@@ -41,6 +44,14 @@ void WangLandau::infrequent_update(const Macrostate& macro) {
   if ((min_visit >= min_visit_per_macro_) &&
       (min_visit >= flatness_threshold_ * average)) {
     flatness_update_();
+    if (one_over_t_ && is_one_over_t_ == 0) {
+      const double inv_t = macro.num_macrostates_in_soft_range()/num_updates_;
+      if (add_to_ln_probability_ < inv_t) {
+        DEBUG("begin 1/t");
+        is_one_over_t_ = 1;
+        add_to_ln_probability_ = inv_t;
+      }
+    }
   }
   ln_prob_.normalize();
 }
@@ -53,6 +64,13 @@ void WangLandau::update(
     const bool is_endpoint,
     const Macrostate& macro) {
   int bin = bin_(macrostate_old, macrostate_new, is_accepted);
+  if (one_over_t_) {
+    num_updates_ += 1.;
+    if (is_one_over_t_ == 1) {
+      add_to_ln_probability_ =
+        macro.num_macrostates_in_soft_range()/num_updates_;
+    }
+  }
   ln_prob_.add(bin, add_to_ln_probability_);
   ++visited_states_[bin];
 }
@@ -100,7 +118,7 @@ static MapWangLandau mapper_ = MapWangLandau();
 
 WangLandau::WangLandau(std::istream& istr) : Bias(istr) {
   const int version = feasst_deserialize_version(istr);
-  ASSERT(version == 247, "mismatch version: " << version);
+  ASSERT(version >= 247 && version <= 248, "mismatch version: " << version);
   feasst_deserialize_fstobj(&(ln_prob_), istr);
   feasst_deserialize(&(add_to_ln_probability_), istr);
   feasst_deserialize(&(reduce_ln_probability_), istr);
@@ -109,12 +127,18 @@ WangLandau::WangLandau(std::istream& istr) : Bias(istr) {
   feasst_deserialize(&(visited_states_), istr);
   feasst_deserialize(&(num_flatness_), istr);
   feasst_deserialize(&(min_flatness_), istr);
+  one_over_t_ = false;
+  if (version >= 248) {
+    feasst_deserialize(&one_over_t_, istr);
+    feasst_deserialize(&is_one_over_t_, istr);
+    feasst_deserialize(&num_updates_, istr);
+  }
 }
 
 void WangLandau::serialize(std::ostream& ostr) const {
   ostr << class_name_ << " ";
   serialize_bias_(ostr);
-  feasst_serialize_version(247, ostr);
+  feasst_serialize_version(248, ostr);
   feasst_serialize_fstobj(ln_prob_, ostr);
   feasst_serialize(add_to_ln_probability_, ostr);
   feasst_serialize(reduce_ln_probability_, ostr);
@@ -123,6 +147,9 @@ void WangLandau::serialize(std::ostream& ostr) const {
   feasst_serialize(visited_states_, ostr);
   feasst_serialize(num_flatness_, ostr);
   feasst_serialize(min_flatness_, ostr);
+  feasst_serialize(one_over_t_, ostr);
+  feasst_serialize(is_one_over_t_, ostr);
+  feasst_serialize(num_updates_, ostr);
 }
 
 void WangLandau::set_num_iterations_to_complete(const int flatness) {
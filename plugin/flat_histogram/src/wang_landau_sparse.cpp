@@ -0,0 +1,204 @@
+#include <algorithm>
+#include <numeric>
+#include "utils/include/serialize.h"
+#include "utils/include/debug.h"
+#include "math/include/constants.h"
+#include "flat_histogram/include/macrostate.h"
+#include "flat_histogram/include/wang_landau_sparse.h"
+
+namespace feasst {
+
+WangLandauSparse::WangLandauSparse(argtype args) : WangLandauSparse(&args) {
+  FEASST_CHECK_ALL_USED(args);
+}
+WangLandauSparse::WangLandauSparse(argtype * args) {
+  class_name_ = "WangLandauSparse";
+  min_flatness_ = integer("min_flatness", args);
+  flatness_threshold_ = dble("flatness_threshold", args, 0.8);
+  add_to_ln_probability_ = dble("add_to_ln_probability", args, 1.);
+  reduce_ln_probability_ = dble("reduce_ln_probability", args, 0.5);
+  min_visit_per_macro_ = integer("min_visit_per_macro", args, 1e3);
+}
+
+int WangLandauSparse::index_of_(const int bin) const {
+  auto pair = index_.find(bin);
+  if (pair == index_.end()) {
+    return -1;
+  }
+  return pair->second;
+}
+
+double WangLandauSparse::value_(const int bin) const {
+  const int index = index_of_(bin);
+  if (index == -1) {
+    return 0.;
+  }
+  return ln_prob_[index];
+}
+
+void WangLandauSparse::add_bin_(const int bin, const double ln_prob,
+    const int visited) {
+  ASSERT(bin >= 0 && bin < size_, "bin: " << bin << " size: " << size_);
+  index_[bin] = static_cast<int>(bins_.size());
+  bins_.push_back(bin);
+  ln_prob_.push_back(ln_prob);
+  visited_states_.push_back(visited);
+}
+
+int WangLandauSparse::visited(const int bin) const {
+  const int index = index_of_(bin);
+  if (index == -1) {
+    return 0;
+  }
+  return visited_states_[index];
+}
+
+void WangLandauSparse::infrequent_update(const Macrostate& macro) {
+  if (bins_.size() == 0) {
+    return;
+  }
+  const int min_visit = *std::min_element(visited_states_.begin(),
+                                          visited_states_.end());
+  const double average = std::accumulate(visited_states_.begin(),
+    visited_states_.end(), 0.)/static_cast<double>(visited_states_.size());
+  if ((min_visit >= min_visit_per_macro_) &&
+      (min_visit >= flatness_threshold_ * average)) {
+    DEBUG("flat over " << bins_.size() << " visited macrostates");
+    std::fill(visited_states_.begin(), visited_states_.end(), 0);
+    add_to_ln_probability_ *= reduce_ln_probability_;
+    ++num_flatness_;
+    if (num_flatness_ >= min_flatness_) {
+      set_complete_();
+    }
+  }
+}
+
+void WangLandauSparse::update(
+    const int macrostate_old,
+    const int macrostate_new,
+    const double ln_metropolis_prob,
+    const bool is_accepted,
+    const bool is_endpoint,
+    const Macrostate& macro) {
+  const int bin = bin_(macrostate_old, macrostate_new, is_accepted);
+  const int index = index_of_(bin);
+  if (index == -1) {
+    add_bin_(bin, add_to_ln_probability_, 1);
+  } else {
+    ln_prob_[index] += add_to_ln_probability_;
+    ++visited_states_[index];
+  }
+  is_dense_current_ = false;
+}
+
+void WangLandauSparse::resize(const Histogram& histogram) {
+  if (size_ != histogram.size()) {
+    size_ = histogram.size();
+    bins_.clear();
+    ln_prob_.clear();
+    visited_states_.clear();
+    index_.clear();
+    is_dense_current_ = false;
+  }
+}
+
+const LnProbability& WangLandauSparse::ln_prob() const {
+  if (!is_dense_current_) {
+    ln_prob_dense_ = LnProbability(std::vector<double>(size_, 0.));
+    if (bins_.size() > 0) {
+      for (int bin = 0; bin < size_; ++bin) {
+        ln_prob_dense_.set_value(bin, -NEAR_INFINITY);
+      }
+      for (int index = 0; index < static_cast<int>(bins_.size()); ++index) {
+        ln_prob_dense_.set_value(bins_[index], ln_prob_[index]);
+      }
+      ln_prob_dense_.normalize();
+    }
+    is_dense_current_ = true;
+  }
+  return ln_prob_dense_;
+}
+
+void WangLandauSparse::set_ln_prob(const LnProbability& ln_prob) {
+  ASSERT(ln_prob.size() == size_, "size mismatch: " <<
+    ln_prob.size() << " " << size_);
+  bins_.clear();
+  ln_prob_.clear();
+  visited_states_.clear();
+  index_.clear();
+  for (int bin = 0; bin < size_; ++bin) {
+    if (ln_prob.value(bin) > -0.5*NEAR_INFINITY) {
+      add_bin_(bin, ln_prob.value(bin), 0);
+    }
+  }
+  is_dense_current_ = false;
+}
+
+std::string WangLandauSparse::write() const {
+  std::stringstream ss;
+  ss << Bias::write();
+  ss << "\"num_flatness\":" << num_flatness_ << ",";
+  ss << "\"num_visited_macrostates\":" << bins_.size() << ",";
+  return ss.str();
+}
+
+std::string WangLandauSparse::write_per_bin_header() const {
+  return std::string("ln_prob,visited");
+}
+
+std::string WangLandauSparse::write_per_bin(const int bin) const {
+  std::stringstream ss;
+  ss << MAX_PRECISION << ln_prob().value(bin) << "," << visited(bin);
+  return ss.str();
+}
+
+class MapWangLandauSparse {
+ public:
+  MapWangLandauSparse() {
+    auto obj = MakeWangLandauSparse({{"min_flatness", "0"}});
+    obj->deserialize_map()["WangLandauSparse"] = obj;
+  }
+};
+
+static MapWangLandauSparse mapper_ = MapWangLandauSparse();
+
+WangLandauSparse::WangLandauSparse(std::istream& istr) : Bias(istr) {
+  const int version = feasst_deserialize_version(istr);
+  ASSERT(version == 4031, "mismatch version: " << version);
+  feasst_deserialize(&add_to_ln_probability_, istr);
+  feasst_deserialize(&reduce_ln_probability_, istr);
+  feasst_deserialize(&min_visit_per_macro_, istr);
+  feasst_deserialize(&flatness_threshold_, istr);
+  feasst_deserialize(&num_flatness_, istr);
+  feasst_deserialize(&min_flatness_, istr);
+  feasst_deserialize(&size_, istr);
+  feasst_deserialize(&bins_, istr);
+  feasst_deserialize(&ln_prob_, istr);
+  feasst_deserialize(&visited_states_, istr);
+  for (int index = 0; index < static_cast<int>(bins_.size()); ++index) {
+    index_[bins_[index]] = index;
+  }
+}
+
+void WangLandauSparse::serialize(std::ostream& ostr) const {
+  ostr << class_name_ << " ";
+  serialize_bias_(ostr);
+  feasst_serialize_version(4031, ostr);
+  feasst_serialize(add_to_ln_probability_, ostr);
+  feasst_serialize(reduce_ln_probability_, ostr);
+  feasst_serialize(min_visit_per_macro_, ostr);
+  feasst_serialize(flatness_threshold_, ostr);
+  feasst_serialize(num_flatness_, ostr);
+  feasst_serialize(min_flatness_, ostr);
+  feasst_serialize(size_, ostr);
+  feasst_serialize(bins_, ostr);
+  feasst_serialize(ln_prob_, ostr);
+  feasst_serialize(visited_states_, ostr);
+}
+
+void WangLandauSparse::set_num_iterations_to_complete(const int flatness) {
+  min_flatness_ = flatness;
+  if (num_flatness_ < min_flatness_) set_incomplete_();
+}
+
+}  // namespace feasst
@@ -3,6 +3,9 @@
 #include "flat_histogram/include/wltm.h"
 #include "utils/include/serialize.h"
 #include "math/include/utils_math.h"
+#include "math/include/accumulator.h"
+#include "math/include/constants.h"
+#include "flat_histogram/include/macrostate.h"
 #include "utils/include/debug.h"
 
 namespace feasst {
@@ -11,6 +14,10 @@ WLTM::WLTM(argtype * args) {
   class_name_ = "WLTM";
   collect_flatness_ = integer("collect_flatness", args);
   min_collect_sweeps_ = integer("min_collect_sweeps", args, -1);
+  max_delta_ln_prob_stdev_ = dble("max_delta_ln_prob_stdev", args, -1.);
+  min_error_blocks_ = integer("min_error_blocks", args, 5);
+  ASSERT(min_error_blocks_ >= 2, "min_error_blocks: " << min_error_blocks_
+    << " must be at least 2");
   wang_landau_ = std::make_shared<WangLandau>(args);
   min_flatness_ = wang_landau_->min_flatness();
   ASSERT(collect_flatness_ < min_flatness_,
@@ -22,8 +29,13 @@ WLTM::WLTM(argtype args) : WLTM(&args) {
   FEASST_CHECK_ALL_USED(args);
 }
 
+bool WLTM::is_wl_flatness_() const {
+  return (is_error_converged_ == 0) &&
+         (wang_landau_->num_flatness() < min_flatness_);
+}
+
 bool WLTM::is_wl_bias_(const Macrostate& macro) const {
-  if ((wang_landau_->num_flatness() < min_flatness_) ||
+  if (is_wl_flatness_() ||
       (transition_matrix_->num_iterations(-1, macro) < min_collect_sweeps_)) {
     return true;
   }
@@ -59,8 +71,16 @@ void WLTM::update(
   }
 }
 
+double WLTM::ln_bias(const int bin_new, const int bin_old) const {
+  if (is_wl_flatness_()) {
+    return wang_landau_->ln_bias(bin_new, bin_old);
+  } else {
+    return transition_matrix_->ln_bias(bin_new, bin_old);
+  }
+}
+
 const LnProbability& WLTM::ln_prob() const {
-  if (wang_landau_->num_flatness() < min_flatness_) {
+  if (is_wl_flatness_()) {
     return wang_landau_->ln_prob();
   } else {
     return transition_matrix_->ln_prob();
@@ -78,14 +98,41 @@ void WLTM::infrequent_update(const Macrostate& macro) {
   }
   if (wang_landau_->num_flatness() >= collect_flatness_) {
     transition_matrix_->infrequent_update(macro);
+    if (max_delta_ln_prob_stdev_ > 0 && is_wl_flatness_()) {
+      const double stdev = delta_ln_prob_stdev(macro);
+      DEBUG("delta_ln_prob_stdev " << stdev);
+      if (stdev < max_delta_ln_prob_stdev_) {
+        is_error_converged_ = 1;
+      }
+    }
   }
 }
 
+double WLTM::delta_ln_prob_stdev(const Macrostate& macro) const {
+  const std::vector<LnProbability> blocks =
+    transition_matrix_->collection().ln_prob_blocks();
+  if (static_cast<int>(blocks.size()) < min_error_blocks_) {
+    return NEAR_INFINITY;
+  }
+  double max_stdev = 0.;
+  for (int bin = macro.soft_min() + 1; bin <= macro.soft_max(); ++bin) {
+    Accumulator delta_ln_prob;
+    for (const LnProbability& block : blocks) {
+      delta_ln_prob.accumulate(block.delta(bin));
+    }
+    max_stdev = std::max(max_stdev, delta_ln_prob.stdev_of_av());
+  }
+  return max_stdev;
+}
+
 std::string WLTM::write() const {
   std::stringstream ss;
   ss << Bias::write();
   ss << wang_landau_->write();
   ss << transition_matrix_->write();
+  if (max_delta_ln_prob_stdev_ > 0) {
+    ss << "\"is_error_converged\":" << is_error_converged_ << ",";
+  }
   return ss.str();
 }
 
@@ -141,11 +188,18 @@ bool WLTM::is_adjust_allowed(const Macrostate& macro) const {
 
 WLTM::WLTM(std::istream& istr) : Bias(istr) {
   const int version = feasst_deserialize_version(istr);
-  ASSERT(version == 1946, "mismatch version: " << version);
+  ASSERT(version >= 1946 && version <= 1947, "mismatch version: " << version);
   feasst_deserialize(&collect_flatness_, istr);
   feasst_deserialize(&min_flatness_, istr);
   feasst_deserialize(&min_collect_sweeps_, istr);
   feasst_deserialize(&production_, istr);
+  max_delta_ln_prob_stdev_ = -1.;
+  min_error_blocks_ = 5;
+  if (version >= 1947) {
+    feasst_deserialize(&max_delta_ln_prob_stdev_, istr);
+    feasst_deserialize(&min_error_blocks_, istr);
+    feasst_deserialize(&is_error_converged_, istr);
+  }
   // HWH for unknown reasons, this function template does not work.
   // feasst_deserialize_fstdr(wang_landau_, istr);
   // feasst_deserialize_fstdr(transition_matrix_, istr);
@@ -163,11 +217,14 @@ WLTM::WLTM(std::istream& istr) : Bias(istr) {
 void WLTM::serialize(std::ostream& ostr) const {
   ostr << class_name_ << " ";
   serialize_bias_(ostr);
-  feasst_serialize_version(1946, ostr);
+  feasst_serialize_version(1947, ostr);
   feasst_serialize(collect_flatness_, ostr);
   feasst_serialize(min_flatness_, ostr);
   feasst_serialize(min_collect_sweeps_, ostr);
   feasst_serialize(production_, ostr);
+  feasst_serialize(max_delta_ln_prob_stdev_, ostr);
+  feasst_serialize(min_error_blocks_, ostr);
+  feasst_serialize(is_error_converged_, ostr);
   feasst_serialize_fstdr(wang_landau_, ostr);
   feasst_serialize_fstdr(transition_matrix_, ostr);
 }
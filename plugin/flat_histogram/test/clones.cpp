@@ -14,6 +14,7 @@
 #include "steppers/include/log_and_movie.h"
 #include "steppers/include/criteria_writer.h"
 #include "steppers/include/criteria_updater.h"
+#include "steppers/include/extensive_moments.h"
 #include "flat_histogram/include/flat_histogram.h"
 #include "flat_histogram/include/transition_matrix.h"
 #include "flat_histogram/include/macrostate_num_particles.h"
@@ -22,7 +23,8 @@
 
 namespace feasst {
 
-MonteCarlo monte_carlo(const int thread, const int min, const int max) {
+MonteCarlo monte_carlo(const int thread, const int min, const int max,
+    const bool fill = true) {
   const int trials_per = 1e2;
   MonteCarlo mc;
   //mc.set(MakeRandomMT19937({{"seed", "1635444301"}}));
@@ -36,7 +38,7 @@ MonteCarlo monte_carlo(const int thread, const int min, const int max) {
   mc.set(MakeMetropolis());
   mc.add(MakeTrialTranslate({{"weight", "1."}, {"tunable_param", "1."}}));
   mc.add(MakeTrialTransfer({{"particle_type", "0"}, {"weight", "4"}}));
-  mc.run(MakeRun({{"until_num_particles", str(min)}}));
+  if (fill) mc.run(MakeRun({{"until_num_particles", str(min)}}));
   mc.set(MakeFlatHistogram(
     MakeMacrostateNumParticles(
       Histogram({{"width", "1"}, {"max", str(max)}, {"min", str(min)}})),
@@ -75,7 +77,8 @@ MonteCarlo monte_carlo(const int thread, const int min, const int max) {
 // 0 1 2 3 4 5 6                : 8 total
 //           5 6 7 8 9          : 7 total
 //                 8 9 10 11 12 : 6 total
-Clones make_clones(const int max, const int min = 0, const int overlap = 4) {
+Clones make_clones(const int max, const int min = 0, const int overlap = 4,
+    const bool fill = true) {
   Clones clones;
   std::vector<std::vector<int> > bounds = WindowExponential({
     {"maximum", str(max)},
@@ -86,7 +89,7 @@ Clones make_clones(const int max, const int min = 0, const int overlap = 4) {
   for (int index = 0; index < static_cast<int>(bounds.size()); ++index) {
     const std::vector<int> bound = bounds[index];
     INFO(bound[0] << " " << bound[1]);
-    auto clone = std::make_shared<MonteCarlo>(monte_carlo(index, bound[0], bound[1]));
+    auto clone = std::make_shared<MonteCarlo>(monte_carlo(index, bound[0], bound[1], fill));
 //    clone->set(MakeRandomMT19937({{"seed", "123"}}));
     clones.add(clone);
   }
@@ -127,6 +130,99 @@ TEST(Clones, lj_fh) {
   for (int i = 9; i < 13; ++i) EXPECT_EQ(energy[i], energy1[i - 5]);
 }
 
+TEST(Clones, swap) {
+  Clones clones = make_clones(12);
+  clones.initialize();
+  int num_accepted = 0;
+  for (int batch = 0; batch < 500; ++batch) {
+    for (int index = 0; index < clones.num(); ++index) {
+      clones.get_clone(index)->attempt(10);
+    }
+    const int num_lower = clones.clone(0).configuration().num_particles();
+    const int num_upper = clones.clone(1).configuration().num_particles();
+    if (clones.attempt_swap(1)) {
+      ++num_accepted;
+      EXPECT_EQ(num_upper, clones.clone(0).configuration().num_particles());
+      EXPECT_EQ(num_lower, clones.clone(1).configuration().num_particles());
+    }
+    Acceptance empty;
+    for (int index = 0; index < clones.num(); ++index) {
+      const MonteCarlo& mc = clones.clone(index);
+      EXPECT_TRUE(mc.criteria().flat_histogram().macrostate().is_allowed(
+        mc.system(), mc.criteria(), empty));
+    }
+  }
+  EXPECT_GT(num_accepted, 0);
+  EXPECT_EQ(1, static_cast<int>(clones.swaps().size()));
+  EXPECT_EQ(500, clones.swaps()[0].num_values());
+  EXPECT_NEAR(num_accepted/500., clones.swaps()[0].average(), NEAR_ZERO);
+  Clones clones2 = test_serialize(clones);
+  EXPECT_EQ(500, clones2.swaps()[0].num_values());
+  TRY(
+    clones.attempt_swap(2);
+    CATCH_PHRASE("out of range");
+  );
+}
+
+TEST(Clones, extensive_moments) {
+  Clones clones = make_clones(12);
+  clones.initialize();
+  for (int index = 0; index < clones.num(); ++index) {
+    clones.get_clone(index)->add(MakeExtensiveMoments({{"max_order", "2"},
+      {"compact", "true"}, {"multistate", "true"},
+      {"trials_per_update", "1"}}));
+    clones.get_clone(index)->attempt(1e3);
+  }
+  const std::vector<ExtensiveMoments> moments = clones.extensive_moments();
+  EXPECT_EQ(13, static_cast<int>(moments.size()));
+  const int analyze = SeekAnalyze().index("ExtensiveMoments",
+                                          clones.clone(0))[0];
+  const auto& lower = clones.clone(0).analyze(analyze).analyzers();
+  const auto& upper = clones.clone(1).analyze(analyze).analyzers();
+  const int first_upper = static_cast<int>(lower.size()) - 4;
+  EXPECT_EQ(first_upper, 5);
+  for (int bin = 0; bin < 13; ++bin) {
+    double num_values = 0.;
+    if (bin < static_cast<int>(lower.size())) {
+      num_values += ExtensiveMoments(*lower[bin]).num_values();
+    }
+    if (bin >= first_upper) {
+      num_values += ExtensiveMoments(*upper[bin - first_upper]).num_values();
+    }
+    EXPECT_DOUBLE_EQ(num_values, moments[bin].num_values());
+  }
+  EXPECT_GT(moments[5].num_values(), 0.);
+  TRY(
+    clones.extensive_moments("Energy");
+    CATCH_PHRASE("is not ExtensiveMoments");
+  );
+}
+
+TEST(Clones, lj_fh_swap_LONG) {
+  Clones clones = make_clones(12);
+  clones.initialize();
+  clones.run_until_complete({{"omp_batch", str(1e1)}, {"swap", "true"}});
+  EXPECT_GT(clones.swaps()[0].num_values(), 0);
+  EXPECT_NEAR(clones.ln_prob().value(0), -36.9, 0.7);
+}
+
+TEST(Clones, pipeline) {
+  for (const std::string seed_from_any : {"false", "true"}) {
+    Clones clones = make_clones(12, 0, 4, false);
+    Acceptance empty;
+    const MonteCarlo& upper = clones.clone(1);
+    EXPECT_FALSE(upper.criteria().flat_histogram().macrostate().is_allowed(
+      upper.system(), upper.criteria(), empty));
+    clones.initialize({{"pipeline", "true"}, {"seed_from_any", seed_from_any}});
+    for (int index = 0; index < clones.num(); ++index) {
+      const MonteCarlo& mc = clones.clone(index);
+      EXPECT_TRUE(mc.criteria().flat_histogram().macrostate().is_allowed(
+        mc.system(), mc.criteria(), empty));
+    }
+    EXPECT_GT(clones.clone(0).trials().num_attempts(), 0);
+  }
+}
+
 double energy_av4(const int macro, const MonteCarlo& mc) {
   return mc.analyzers().back()->analyzers()[macro]->accumulator().average();
 }
@@ -1,6 +1,8 @@
 #include <vector>
 #include <memory>
+#include <sstream>
 #include "utils/test/utils.h"
+#include "math/include/random_mt19937.h"
 #include "flat_histogram/include/collection_matrix.h"
 
 namespace feasst {
@@ -35,6 +37,55 @@ TEST(CollectionMatrix, serialize) {
 //  EXPECT_EQ(1, colmat3.min_blocks_());
 }
 
+TEST(CollectionMatrix, compact) {
+  CollectionMatrix full;
+  CollectionMatrix compact(argtype({{"compact", "true"}, {"max_blocks", "8"}}));
+  EXPECT_TRUE(compact.is_compact());
+  full.resize(4);
+  compact.resize(4);
+  EXPECT_EQ(4, compact.size());
+  auto random = MakeRandomMT19937({{"seed", "123"}});
+  for (int trial = 0; trial < 10000; ++trial) {
+    const int macro = random->uniform(0, 3);
+    const double down = random->uniform(), up = random->uniform();
+    full.increment(macro, 0, down);
+    full.increment(macro, 1, up);
+    compact.increment(macro, 0, down);
+    compact.increment(macro, 1, up);
+  }
+  for (int macro = 0; macro < 4; ++macro) {
+    for (int change = 0; change < 2; ++change) {
+      EXPECT_NEAR(full.average(macro, change), compact.average(macro, change),
+                  1e-12);
+      EXPECT_DOUBLE_EQ(full.num_values(macro, change),
+                       compact.num_values(macro, change));
+    }
+  }
+  LnProbability ln_full, ln_compact;
+  ln_full.resize(4);
+  ln_compact.resize(4);
+  full.compute_ln_prob(&ln_full);
+  compact.compute_ln_prob(&ln_compact);
+  EXPECT_TRUE(ln_full.is_equal(ln_compact, 1e-10));
+  EXPECT_GE(compact.min_blocks(), 4);
+  EXPECT_LT(compact.min_blocks(), 8);
+  EXPECT_EQ(compact.min_blocks(),
+            static_cast<int>(compact.ln_prob_blocks().size()));
+  TRY(
+    compact.matrix();
+    CATCH_PHRASE("not available in the compact mode");
+  );
+
+  CollectionMatrix compact2 = test_serialize(compact);
+  EXPECT_TRUE(compact.is_equal(compact2, NEAR_ZERO));
+  compact2.compute_ln_prob(&ln_compact);
+  EXPECT_TRUE(ln_full.is_equal(ln_compact, 1e-10));
+  std::stringstream full_ss, compact_ss;
+  full.serialize(full_ss);
+  compact.serialize(compact_ss);
+  EXPECT_LT(3*compact_ss.str().size(), full_ss.str().size());
+}
+
 //TEST(CollectionMatrix, blocks) {
 //  auto cm = MakeCollectionMatrix();
 //  cm->resize(6);
@@ -19,12 +19,13 @@
 #include "flat_histogram/include/wltm.h"
 #include "flat_histogram/include/macrostate_num_particles.h"
 #include "flat_histogram/include/window_exponential.h"
+#include "flat_histogram/include/shared_window.h"
 #include "flat_histogram/include/collection_matrix_splice.h"
 
 namespace feasst {
 
 MonteCarlo monte_carlo2(const int thread, const int min, const int max,
-    const int soft_min, const int soft_max) {
+    const int soft_min, const int soft_max, const bool multistate = true) {
   DEBUG("min " << min);
   DEBUG("max " << max);
   const int trials_per = 1e2;
@@ -50,7 +51,7 @@ MonteCarlo monte_carlo2(const int thread, const int min, const int max,
     //MakeWLTM({{"min_sweeps", "100000"}, {"new_sweep", "1"}, {"min_flatness", "25"}, {"collect_flatness", "20"}})));//, {"max_block_operations", "6"}})));
     MakeTransitionMatrix({{"min_sweeps", "100000"}, {"new_sweep", "1"}})));//, {"max_block_operations", "6"}})));
   mc.add(MakeCheckEnergy({{"trials_per_write", str(trials_per)}}));
-  mc.add(MakeTune({{"trials_per_write", str(trials_per)}, {"multistate", "true"}, {"file_name", "tune" + str(thread)}}));
+  mc.add(MakeTune({{"trials_per_write", str(trials_per)}, {"multistate", str(multistate)}, {"file_name", "tune" + str(thread)}}));
 //  mc.add(MakeLogAndMovie({{"trials_per_write", str(trials_per)},
 //    {"file_name", "tmp/clones" + str(thread)}}));
   mc.add(MakeCriteriaUpdater({{"trials_per_update", str(trials_per)}}));
@@ -63,15 +64,17 @@ MonteCarlo monte_carlo2(const int thread, const int min, const int max,
     {"file_name", "tmp/clone_energy" + str(thread)},
     {"trials_per_update", "1"},
     {"trials_per_write", str(trials_per)},
-    {"multistate", "true"}}));
+    {"multistate", str(multistate)}}));
   return mc;
 }
 
-CollectionMatrixSplice make_splice(const int max, const int min = 0) {
-  auto cm = MakeCollectionMatrixSplice({{"min_window_size", "2"},
-    {"ln_prob_file", "tmp/lnpi.txt"},
-    {"ln_prob_file_append", "true"},
-    {"hours_per", "0.00001"}});
+CollectionMatrixSplice make_splice(const int max, const int min = 0,
+    argtype args = argtype(), const bool multistate = true) {
+  args.insert({"min_window_size", "2"});
+  args.insert({"ln_prob_file", "tmp/lnpi.txt"});
+  args.insert({"ln_prob_file_append", "true"});
+  args.insert({"hours_per", "0.00001"});
+  auto cm = MakeCollectionMatrixSplice(args);
   std::vector<std::vector<int> > bounds = WindowExponential({
     {"maximum", str(max)},
     {"minimum", str(min)},
@@ -82,7 +85,7 @@ CollectionMatrixSplice make_splice(const int max, const int min = 0) {
   for (int index = 0; index < static_cast<int>(bounds.size()); ++index) {
     const std::vector<int> bound = bounds[index];
     DEBUG(bound[0] << " " << bound[1]);
-    auto clone = std::make_shared<MonteCarlo>(monte_carlo2(index, min, max, bound[0], bound[1]));
+    auto clone = std::make_shared<MonteCarlo>(monte_carlo2(index, min, max, bound[0], bound[1], multistate));
     cm->add(clone);
   }
   return test_serialize(*cm);
@@ -118,6 +121,104 @@ TEST(CollectionMatrixSplice, lj_fh) {
   clones2.write("tmp/ln_prob.txt");
 }
 
+TEST(CollectionMatrixSplice, balance_throughput) {
+  CollectionMatrixSplice splice = make_splice(12, 0,
+    {{"balance_throughput", "true"}});
+  const int lower_size = splice.clone(0).criteria().macrostate().num_macrostates_in_soft_range();
+  const int upper_size = splice.clone(1).criteria().macrostate().num_macrostates_in_soft_range();
+  EXPECT_EQ(13, lower_size + upper_size);
+  TRY(
+    splice.throughput_shift(0);
+    CATCH_PHRASE("trials per second not measured");
+  );
+  // with equal rates and iterations, balance the number of macrostates
+  splice.set_trials_per_second(0, 1e6);
+  splice.set_trials_per_second(1, 1e6);
+  const int shift = splice.throughput_shift(0);
+  EXPECT_LE(std::abs(lower_size - shift - upper_size - shift), 1);
+
+  // a slower upper window gives macrostates to the lower window
+  splice.set_trials_per_second(1, 1e5);
+  EXPECT_EQ(-(upper_size - 2), splice.throughput_shift(0));
+  splice.adjust_bounds();
+  EXPECT_LE(splice.clone(1).criteria().macrostate().num_macrostates_in_soft_range(),
+            upper_size);
+  CollectionMatrixSplice splice2 = test_serialize(splice);
+  EXPECT_DOUBLE_EQ(1e5, splice2.trials_per_second()[1]);
+}
+
+TEST(CollectionMatrixSplice, shared_file) {
+  for (const std::string file : {"tmp/shared_cm0", "tmp/shared_cm1",
+      "tmp/shared_cm0_bounds", "tmp/shared_cm1_bounds"}) {
+    std::remove(file.c_str());
+  }
+  CollectionMatrixSplice splice = make_splice(12, 0,
+    {{"shared_file", "tmp/shared_cm"}, {"balance_throughput", "true"}}, false);
+  EXPECT_FALSE(splice.read_published());
+  splice.run(0.0001);
+  splice.publish(0);
+  EXPECT_FALSE(splice.read_published());
+  splice.publish(1);
+  EXPECT_TRUE(splice.read_published());
+  LnProbability ln_prob;
+  ln_prob.resize(13);
+  splice.published_collection_matrix().compute_ln_prob(&ln_prob);
+  EXPECT_TRUE(ln_prob.is_equal(splice.ln_prob(), 1e-8));
+
+  // a second reader, such as a coordinator in another process
+  CollectionMatrixSplice reader = make_splice(12, 0,
+    {{"shared_file", "tmp/shared_cm"}});
+  EXPECT_TRUE(reader.read_published());
+  reader.published_collection_matrix().compute_ln_prob(&ln_prob);
+  EXPECT_TRUE(ln_prob.is_equal(splice.ln_prob(), 1e-8));
+  EXPECT_EQ(splice.collection_matrix().min_blocks(),
+            reader.published_collection_matrix().min_blocks());
+
+  // a slower upper window gives macrostates to the lower window
+  const int lower_max = splice.flat_histogram(0).macrostate().soft_max();
+  const int upper_max = splice.flat_histogram(1).macrostate().soft_max();
+  splice.set_trials_per_second(0, 1e6);
+  splice.set_trials_per_second(1, 1e5);
+  splice.publish(0);
+  splice.publish(1);
+  const LnProbability ln_prob_before = splice.ln_prob();
+  CollectionMatrixSplice coordinator = make_splice(12, 0,
+    {{"shared_file", "tmp/shared_cm"}, {"balance_throughput", "true"}}, false);
+  coordinator.adjust_published_bounds();
+  SharedWindow lower("tmp/shared_cm0"), upper("tmp/shared_cm1");
+  int min, max, min1, max1;
+  ASSERT_TRUE(lower.requested_bounds(&min, &max));
+  ASSERT_TRUE(upper.requested_bounds(&min1, &max1));
+  EXPECT_GT(max, lower_max);
+  EXPECT_EQ(max + 1, min1);
+  EXPECT_EQ(upper_max, max1);
+
+  // multistate data cannot be moved with the macrostates
+  TRY(
+    reader.apply_requested_bounds(1);
+    CATCH_PHRASE("multistate");
+  );
+
+  // the upper window does not give up macrostates until the lower has them
+  splice.apply_requested_bounds(1);
+  EXPECT_EQ(lower_max + 1, splice.flat_histogram(1).macrostate().soft_min());
+  splice.apply_requested_bounds(0);
+  EXPECT_EQ(max, splice.flat_histogram(0).macrostate().soft_max());
+  splice.apply_requested_bounds(1);
+  EXPECT_LE(splice.flat_histogram(1).macrostate().soft_min(), min1);
+  EXPECT_TRUE(coordinator.read_published());
+  coordinator.published_collection_matrix().compute_ln_prob(&ln_prob);
+  EXPECT_TRUE(ln_prob.is_equal(ln_prob_before, 1e-8));
+
+  // a coordinator terminates if windows stop publishing
+  CollectionMatrixSplice stale = make_splice(12, 0,
+    {{"shared_file", "tmp/shared_cm"}, {"timeout_hours", "1e-9"}});
+  TRY(
+    stale.coordinate();
+    CATCH_PHRASE("has not published");
+  );
+}
+
 TEST(CollectionMatrixSplice, lj_fh_LONG) {
   CollectionMatrixSplice clones2 = make_splice(5, 1);
   clones2.get_clone(0)->write_to_file();
@@ -1,3 +1,4 @@
+#include <chrono>
 #include "utils/test/utils.h"
 #include "math/include/histogram.h"
 #include "math/include/random_mt19937.h"
@@ -220,8 +221,14 @@ MonteCarlo test_lj_fh(const int num_steps,
 
 TEST(MonteCarlo, lj_fh_01) {
   MonteCarlo mc = test_lj_fh(1, "TM", 10, false, 0, 1);
+  const std::chrono::steady_clock::time_point begin =
+    std::chrono::steady_clock::now();
   mc.run_until_complete();
+  const double hours = std::chrono::duration<double>(
+    std::chrono::steady_clock::now() - begin).count()/60./60.;
   FlatHistogram fh(mc.criteria());
+  EXPECT_GT(fh.bias_update_hours(), 0.);
+  EXPECT_LE(fh.bias_update_hours(), hours);
   const LnProbability lnpi = fh.bias().ln_prob();
   EXPECT_NEAR(lnpi.value(1) - lnpi.value(0), 4.67, 0.2);
 
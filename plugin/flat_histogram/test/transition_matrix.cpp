@@ -1,4 +1,8 @@
+#include <cmath>
 #include "utils/test/utils.h"
+#include "math/include/constants.h"
+#include "math/include/random_mt19937.h"
+#include "flat_histogram/include/macrostate_num_particles.h"
 #include "flat_histogram/include/transition_matrix.h"
 
 namespace feasst {
@@ -17,4 +21,41 @@ TEST(TransitionMatrix, args) {
   );
 }
 
+// Compare the incremental ln_prob with a full computation during a random
+// walk which only visits the upper macrostates after the first updates.
+TEST(TransitionMatrix, incremental) {
+  auto macro = MakeMacrostateNumParticles(
+    Histogram({{"width", "1"}, {"max", "9"}}));
+  auto tm = MakeTransitionMatrix({{"min_sweeps", "1"}});
+  tm->resize(macro->histogram());
+  auto random = MakeRandomMT19937({{"seed", "123"}});
+  int state = 0;
+  for (int trial = 0; trial < 20000; ++trial) {
+    const int min = trial < 10000 ? 0 : 5;
+    const int state_new = state + (random->coin_flip() ? 1 : -1);
+    if (state_new >= min && state_new <= 9) {
+      const double ln_met = 0.3*(state_new - state);
+      const bool is_accepted = random->uniform() <
+        std::exp(ln_met + tm->ln_bias(state_new, state));
+      tm->update(state, state_new, ln_met, is_accepted,
+                 state_new == min || state_new == 9, *macro);
+      if (is_accepted) {
+        state = state_new;
+      }
+    } else {
+      // as in FlatHistogram, record proposals beyond the bounds as rejected
+      tm->update(state, state, -NEAR_INFINITY, false, false, *macro);
+    }
+    if (trial % 100 == 0) {
+      tm->infrequent_update(*macro);
+      LnProbability ln_prob(std::vector<double>(10, 0.));
+      tm->collection().compute_ln_prob(&ln_prob);
+      EXPECT_TRUE(ln_prob.is_equal(tm->ln_prob(), 1e-10));
+    }
+  }
+  EXPECT_NEAR(1., tm->ln_prob().sum_probability(), NEAR_ZERO);
+  const LnProbability& ln_prob = tm->ln_prob();
+  EXPECT_NEAR(0.3, (ln_prob.value(9) - ln_prob.value(5))/4., 0.1);
+}
+
 }  // namespace feasst
@@ -1,4 +1,5 @@
 #include "utils/test/utils.h"
+#include "flat_histogram/include/macrostate_num_particles.h"
 #include "flat_histogram/include/wang_landau.h"
 
 namespace feasst {
@@ -10,4 +11,31 @@ TEST(WangLandau, args) {
   );
 }
 
+TEST(WangLandau, one_over_t) {
+  auto macro = MakeMacrostateNumParticles(
+    Histogram({{"width", "1"}, {"max", "4"}}));
+  auto wl = MakeWangLandau({{"min_flatness", "10"},
+    {"add_to_ln_probability", "0.01"}, {"min_visit_per_macro", "10"},
+    {"one_over_t", "true"}});
+  wl->resize(macro->histogram());
+  for (int trial = 0; trial < 400; ++trial) {
+    wl->update(trial % 5, trial % 5, 0., true, false, *macro);
+  }
+  EXPECT_FALSE(wl->is_one_over_t());
+  EXPECT_DOUBLE_EQ(0.01, wl->add_to_ln_probability());
+  // the flatness check reduces 0.01 to 0.005, which is less than 5/400.
+  wl->infrequent_update(*macro);
+  EXPECT_EQ(1, wl->num_flatness());
+  EXPECT_TRUE(wl->is_one_over_t());
+  EXPECT_DOUBLE_EQ(5./400., wl->add_to_ln_probability());
+  for (int trial = 400; trial < 1000; ++trial) {
+    wl->update(trial % 5, trial % 5, 0., true, false, *macro);
+  }
+  EXPECT_DOUBLE_EQ(5./1000., wl->add_to_ln_probability());
+  auto wl2 = std::dynamic_pointer_cast<WangLandau>(
+    test_serialize<WangLandau, Bias>(*wl));
+  wl2->update(0, 0, 0., true, false, *macro);
+  EXPECT_DOUBLE_EQ(5./1001., wl2->add_to_ln_probability());
+}
+
 }  // namespace feasst
@@ -0,0 +1,69 @@
+#include "utils/test/utils.h"
+#include "math/include/random_mt19937.h"
+#include "system/include/lennard_jones.h"
+#include "system/include/long_range_corrections.h"
+#include "monte_carlo/include/monte_carlo.h"
+#include "monte_carlo/include/trial_transfer.h"
+#include "monte_carlo/include/trial_translate.h"
+#include "steppers/include/check_energy.h"
+#include "steppers/include/criteria_updater.h"
+#include "flat_histogram/include/flat_histogram.h"
+#include "flat_histogram/include/macrostate_num_particles_energy.h"
+#include "flat_histogram/include/wang_landau_sparse.h"
+
+namespace feasst {
+
+TEST(MacrostateNumParticlesEnergy, serialize) {
+  auto macro = MakeMacrostateNumParticlesEnergy({{"width", "1"}, {"max", "3"},
+    {"energy_width", "0.5"}, {"energy_max", "1"}, {"energy_min", "-6"}});
+  EXPECT_EQ(4*15, macro->histogram().size());
+  EXPECT_DOUBLE_EQ(2, macro->num_particles(2*15 + 5));
+  EXPECT_DOUBLE_EQ(-3.5, macro->energy(2*15 + 5));
+  auto macro2 = test_serialize<MacrostateNumParticlesEnergy, Macrostate>(*macro);
+  TRY(
+    MakeMacrostateNumParticlesEnergy({{"width", "1"}, {"max", "3"},
+      {"energy_width", "0.5"}, {"energy_max", "1"}, {"energy_min", "-6"},
+      {"soft_macro_max", "2"}});
+    CATCH_PHRASE("does not support soft limits");
+  );
+}
+
+TEST(WangLandauSparse, lj_2d) {
+  MonteCarlo mc;
+  mc.set(MakeRandomMT19937({{"seed", "123"}}));
+  mc.add(MakeConfiguration({{"cubic_side_length", "8"},
+                            {"particle_type0", "../particle/lj.fstprt"}}));
+  mc.add(MakePotential(MakeLennardJones()));
+  mc.add(MakePotential(MakeLongRangeCorrections()));
+  mc.set(MakeThermoParams({{"beta", str(1./1.5)},
+    {"chemical_potential", "-2.352321"}}));
+  auto macro = MakeMacrostateNumParticlesEnergy({{"width", "1"}, {"max", "3"},
+    {"energy_width", "0.5"}, {"energy_max", "1"}, {"energy_min", "-6"}});
+  mc.set(MakeFlatHistogram(macro,
+    MakeWangLandauSparse({{"min_flatness", "2"},
+                          {"min_visit_per_macro", "10"}})));
+  mc.add(MakeTrialTranslate({{"tunable_param", "1."}}));
+  mc.add(MakeTrialTransfer({{"particle_type", "0"}}));
+  mc.add(MakeCriteriaUpdater({{"trials_per_update", "1e2"}}));
+  mc.add(MakeCheckEnergy({{"trials_per_update", "1e3"}}));
+  mc.attempt(1e5);
+  const auto& wl = dynamic_cast<const WangLandauSparse&>(
+    mc.criteria().flat_histogram().bias());
+  const int num_visited = static_cast<int>(wl.bins().size());
+  EXPECT_GT(num_visited, 4);
+  EXPECT_LT(num_visited, macro->histogram().size());
+  std::vector<int> num_energies(4, 0);
+  for (const int bin : wl.bins()) {
+    ++num_energies[static_cast<int>(macro->num_particles(bin))];
+  }
+  EXPECT_EQ(1, num_energies[0]);
+  EXPECT_GT(num_energies[3], 1);
+  EXPECT_NEAR(1., wl.ln_prob().sum_probability(), NEAR_ZERO);
+  MonteCarlo mc2 = test_serialize(mc);
+  const auto& wl2 = dynamic_cast<const WangLandauSparse&>(
+    mc2.criteria().flat_histogram().bias());
+  EXPECT_EQ(wl.bins(), wl2.bins());
+  EXPECT_TRUE(wl.ln_prob().is_equal(wl2.ln_prob(), NEAR_ZERO));
+}
+
+}  // namespace feasst
@@ -1,4 +1,8 @@
+#include <cmath>
 #include "utils/test/utils.h"
+#include "math/include/constants.h"
+#include "math/include/random_mt19937.h"
+#include "flat_histogram/include/macrostate_num_particles.h"
 #include "flat_histogram/include/wltm.h"
 
 namespace feasst {
@@ -12,4 +16,48 @@ TEST(WLTM, serialize) {
   std::shared_ptr<Bias> bias2 = test_serialize<WLTM, Bias>(*bias);
 }
 
+// Random walk in a macrostate with a probability that increases by a factor
+// of exp(0.5) for each macrostate.
+TEST(WLTM, max_delta_ln_prob_stdev) {
+  auto macro = MakeMacrostateNumParticles(
+    Histogram({{"width", "1"}, {"max", "4"}}));
+  auto bias = MakeWLTM({{"collect_flatness", "1"},
+                        {"min_flatness", "100"},
+                        {"min_sweeps", "1"},
+                        {"min_visit_per_macro", "10"},
+                        {"max_delta_ln_prob_stdev", "0.02"}});
+  bias->resize(macro->histogram());
+  auto random = MakeRandomMT19937({{"seed", "123"}});
+  int state = 0;
+  for (int trial = 0; trial < 1e6 && !bias->is_error_converged(); ++trial) {
+    const int state_new = state + (random->coin_flip() ? 1 : -1);
+    if (state_new >= 0 && state_new <= 4) {
+      const double ln_met = 0.5*(state_new - state);
+      const bool is_accepted = random->uniform() <
+        std::exp(ln_met + bias->ln_bias(state_new, state));
+      bias->update(state, state_new, ln_met, is_accepted,
+                   state_new == 0 || state_new == 4, *macro);
+      if (is_accepted) {
+        state = state_new;
+      }
+    } else {
+      // as in FlatHistogram, record proposals beyond the bounds as rejected
+      bias->update(state, state, -NEAR_INFINITY, false, false, *macro);
+    }
+    if (trial % 1000 == 0) {
+      bias->infrequent_update(*macro);
+    }
+  }
+  EXPECT_TRUE(bias->is_error_converged());
+  EXPECT_LT(bias->delta_ln_prob_stdev(*macro), 0.02);
+  const LnProbability& ln_prob = bias->ln_prob();
+  EXPECT_EQ(&ln_prob, &bias->transition_matrix().ln_prob());
+  for (int bin = 1; bin < 5; ++bin) {
+    EXPECT_NEAR(0.5, ln_prob.delta(bin), 0.1);
+  }
+  auto bias2 = std::dynamic_pointer_cast<WLTM>(
+    test_serialize<WLTM, Bias>(*bias));
+  EXPECT_TRUE(bias2->is_error_converged());
+}
+
 }  // namespace feasst
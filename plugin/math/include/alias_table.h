@@ -0,0 +1,64 @@
+
+#ifndef FEASST_MATH_ALIAS_TABLE_H_
+#define FEASST_MATH_ALIAS_TABLE_H_
+
+#include <vector>
+#include <iostream>
+
+namespace feasst {
+
+/**
+  Walker's alias method for sampling an index with probability proportional
+  to a given weight.
+  The table is constructed in O(n) using the method of Vose,
+  IEEE Trans. Software Eng. 17, 972-975 (1991).
+  https://doi.org/10.1109/32.92917
+
+  Each index is then sampled in O(1) from a single uniform random number,
+  as opposed to a linear search through a cumulative probability.
+  Thus, the table should be rebuilt only when the weights change.
+ */
+class AliasTable {
+ public:
+  AliasTable() {}
+
+  /// Construct from weights.
+  explicit AliasTable(const std::vector<double>& weights) {
+    set_weights(weights); }
+
+  /// Rebuild the table from weights, which must be non-negative with a
+  /// positive sum.
+  void set_weights(const std::vector<double>& weights);
+
+  /// Return the number of indices.
+  int size() const { return static_cast<int>(probability_.size()); }
+
+  /// Return the probability of an index.
+  double probability(const int index) const;
+
+  /// Return an index given a uniform random number in [0, 1).
+  int index(const double uniform) const {
+    const double scaled = uniform*static_cast<double>(size());
+    int bin = static_cast<int>(scaled);
+    if (bin >= size()) bin = size() - 1;
+    if (scaled - static_cast<double>(bin) < threshold_[bin]) {
+      return bin;
+    }
+    return alias_[bin];
+  }
+
+  /// Serialize.
+  void serialize(std::ostream& ostr) const;
+
+  /// Deserialize.
+  explicit AliasTable(std::istream& istr);
+
+ private:
+  std::vector<double> probability_;
+  std::vector<double> threshold_;
+  std::vector<int> alias_;
+};
+
+}  // namespace feasst
+
+#endif  // FEASST_MATH_ALIAS_TABLE_H_
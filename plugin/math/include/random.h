@@ -13,12 +13,18 @@
 
 namespace feasst {
 
+class AliasTable;
 class RotationMatrix;
 
 /**
   Psuedo random number generator class.
   Note that all other Random distributions depend upon the uniform distribution,
   such that reproduction by storage is simplified.
+
+  Uniform random numbers are generated in bulk into a buffer, which is then
+  consumed by uniform() and all of the distributions which depend upon it.
+  The buffer and its position are serialized, such that a restart from a
+  checkpoint reproduces the same sequence.
  */
 class Random {
  public:
@@ -31,6 +37,8 @@ class Random {
       the time will be used to generate a seed.
       If the string "default" is provided, then use the default integer
       included in Random::seed().
+    - buffer_size: number of uniform random numbers generated at once.
+      If 1, generate one at a time (default: 64).
    */
   explicit Random(argtype * args);
 
@@ -122,6 +130,9 @@ class Random {
   /// In addition, it must end with the value of unity.
   int index_from_cumulative_probability(const std::vector<double>& cumulative);
 
+  /// Same as above, but in O(1) from a table of the probabilities.
+  int index_from_alias_table(const AliasTable& table);
+
   /// Return a random quaternion using the method of:
   /// Franz J. Vesely, J. Comput. Phys., 47, 291-296 (1982).
   void quaternion(Position * quaternion);
@@ -185,6 +196,10 @@ class Random {
   void set_cache_to_unload(const Random& random) {
     cache_.set_unload(random.cache()); }
 
+  /// Return the size of the buffer of uniform random numbers, or zero if
+  /// they are generated one at a time.
+  int buffer_size() const { return static_cast<int>(buffer_.size()); }
+
   /// Serialize.
   std::string class_name() const { return class_name_; }
   virtual void serialize(std::ostream& ostr) const = 0;
@@ -201,12 +216,25 @@ class Random {
   void serialize_random_(std::ostream& ostr) const;
   explicit Random(std::istream& istr);
 
+  /// Return the number of generated uniform random numbers in the buffer
+  /// which have not been used.
+  int num_buffered_() const {
+    return static_cast<int>(buffer_.size()) - buffer_position_; }
+
+  /// Discard the unused uniform random numbers in the buffer.
+  void clear_buffer_() { buffer_position_ = static_cast<int>(buffer_.size()); }
+
  private:
   Cache cache_;
   bool is_seeded_ = false;
+  std::vector<double> buffer_;
+  int buffer_position_ = 0;
 
   virtual void reseed_(const int seed) = 0;
   virtual double gen_uniform_() = 0;
+
+  // Fill the buffer. By default, gen_uniform_ is called for each element.
+  virtual void gen_uniforms_(std::vector<double> * uniforms);
   virtual int gen_uniform_(const int min, const int max);
 };
 
@@ -39,6 +39,8 @@ class RandomMT19937 : public Random {
 
   double gen_uniform_() override { return dis_double_(generator_); }
 
+  void gen_uniforms_(std::vector<double> * uniforms) override;
+
   int gen_uniform_(const int min, const int max) override;
 };
 
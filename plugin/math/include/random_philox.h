@@ -0,0 +1,85 @@
+
+#ifndef FEASST_MATH_RANDOM_PHILOX_H_
+#define FEASST_MATH_RANDOM_PHILOX_H_
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include "math/include/random.h"
+
+namespace feasst {
+
+/**
+  Counter-based Philox4x32-10 generator of
+  Salmon, Moraes, Dror and Shaw, SC11 (2011).
+  https://doi.org/10.1145/2063384.2063405
+
+  Each uniform random number is a function of the seed, the stream and the
+  offset (the number of uniform random numbers generated from the stream
+  so far), without any other sequential state.
+  Thus, the generator may jump to any stream or offset in O(1), and parallel
+  threads may each use their own stream of the same seed.
+  For example, Prefetch uses the offset at the beginning of an accepted trial
+  to reproduce that trial on the other threads, rather than storing the
+  random numbers in the Cache.
+ */
+class RandomPhilox : public Random {
+ public:
+  /**
+    args:
+    - stream: index of the independent stream of random numbers (default: 0).
+   */
+  explicit RandomPhilox(argtype args = argtype());
+  explicit RandomPhilox(argtype * args);
+
+  /// Return the stream.
+  uint32_t stream() const { return stream_; }
+
+  /// Set the stream.
+  void set_stream(const uint32_t stream);
+
+  /// Return the number of uniform random numbers used from the stream.
+  /// Those generated in the buffer, but not yet used, are not included.
+  uint64_t offset() const { return offset_ - num_buffered_(); }
+
+  /// Jump to an offset in the stream.
+  void set_offset(const uint64_t offset);
+
+  /// Fill the vector with the next uniform random numbers of the stream.
+  /// This is equivalent to, but faster than, successive calls to uniform().
+  /// Note that these numbers are not stored in the Cache.
+  void fill_uniform(std::vector<double> * uniforms);
+
+  // serialize
+  std::shared_ptr<Random> create(std::istream& istr) const override {
+    return std::make_shared<RandomPhilox>(istr); }
+  std::shared_ptr<Random> create(argtype * args) const override {
+    return std::make_shared<RandomPhilox>(args); }
+  void serialize(std::ostream& ostr) const override;
+  explicit RandomPhilox(std::istream& istr);
+  virtual ~RandomPhilox() {}
+
+ private:
+  uint32_t key_ = 0;
+  uint32_t stream_;
+  uint64_t offset_ = 0;
+
+  // temporary
+  uint64_t block_index_ = 0;
+  double block_[2];
+  bool is_block_ = false;
+
+  void reseed_(const int seed) override;
+  double gen_uniform_() override;
+  void gen_uniforms_(std::vector<double> * uniforms) override;
+  void compute_block_(const uint64_t block_index, double * uniforms) const;
+};
+
+inline std::shared_ptr<RandomPhilox> MakeRandomPhilox(
+    argtype args = argtype()) {
+  return std::make_shared<RandomPhilox>(args);
+}
+
+}  // namespace feasst
+
+#endif  // FEASST_MATH_RANDOM_PHILOX_H_
@@ -0,0 +1,66 @@
+#include "utils/include/debug.h"
+#include "utils/include/serialize.h"
+#include "math/include/alias_table.h"
+
+namespace feasst {
+
+void AliasTable::set_weights(const std::vector<double>& weights) {
+  const int num = static_cast<int>(weights.size());
+  ASSERT(num > 0, "no weights");
+  double total = 0.;
+  for (const double weight : weights) {
+    ASSERT(weight >= 0., "weight: " << weight << " must be >= 0");
+    total += weight;
+  }
+  ASSERT(total > 0., "sum of weights: " << total << " must be > 0");
+  probability_.resize(num);
+  threshold_.resize(num);
+  alias_.resize(num);
+  std::vector<int> small, large;
+  for (int index = 0; index < num; ++index) {
+    probability_[index] = weights[index]/total;
+    threshold_[index] = probability_[index]*static_cast<double>(num);
+    alias_[index] = index;
+    if (threshold_[index] < 1.) {
+      small.push_back(index);
+    } else {
+      large.push_back(index);
+    }
+  }
+  while (small.size() > 0 && large.size() > 0) {
+    const int less = small.back();
+    small.pop_back();
+    const int more = large.back();
+    alias_[less] = more;
+    threshold_[more] -= 1. - threshold_[less];
+    if (threshold_[more] < 1.) {
+      large.pop_back();
+      small.push_back(more);
+    }
+  }
+  // remaining bins are unity, up to round off
+  for (const int index : large) threshold_[index] = 1.;
+  for (const int index : small) threshold_[index] = 1.;
+}
+
+double AliasTable::probability(const int index) const {
+  ASSERT(index < size(), "index: " << index << " >= size: " << size());
+  return probability_[index];
+}
+
+void AliasTable::serialize(std::ostream& ostr) const {
+  feasst_serialize_version(8537, ostr);
+  feasst_serialize(probability_, ostr);
+  feasst_serialize(threshold_, ostr);
+  feasst_serialize(alias_, ostr);
+}
+
+AliasTable::AliasTable(std::istream& istr) {
+  const int version = feasst_deserialize_version(istr);
+  ASSERT(version == 8537, "unrecognized version: " << version);
+  feasst_deserialize(&probability_, istr);
+  feasst_deserialize(&threshold_, istr);
+  feasst_deserialize(&alias_, istr);
+}
+
+}  // namespace feasst
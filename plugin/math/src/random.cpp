@@ -7,10 +7,18 @@
 #include "math/include/utils_math.h"
 #include "math/include/constants.h"
 #include "math/include/matrix.h"
+#include "math/include/alias_table.h"
 
 namespace feasst {
 
-Random::Random(argtype * args) {}
+Random::Random(argtype * args) {
+  const int buffer_size = integer("buffer_size", args, 64);
+  ASSERT(buffer_size >= 1, "buffer_size: " << buffer_size << " must be >= 1");
+  if (buffer_size > 1) {
+    buffer_.resize(buffer_size);
+    clear_buffer_();
+  }
+}
 
 // parsing seed in constructor leads to pure virtual function reseed_
 void Random::parse_seed_(argtype * args) {
@@ -32,6 +40,7 @@ void Random::seed_by_time() {
   std::cout << "# initializing random number generator with seed: "
             << t << std::endl;
   reseed_(t);
+  clear_buffer_();
   is_seeded_ = true;
 }
 
@@ -40,6 +49,7 @@ void Random::seed(const int seed) {
   std::cout << "# initializing random number generator with seed: "
             << seed << std::endl;
   reseed_(seed);
+  clear_buffer_();
   is_seeded_ = true;
 }
 
@@ -49,22 +59,39 @@ double Random::uniform() {
   }
   double ran;
   if (!cache_.is_unloading(&ran)) {
-    ran = gen_uniform_();
+    if (buffer_.size() == 0) {
+      ran = gen_uniform_();
+    } else {
+      if (buffer_position_ == static_cast<int>(buffer_.size())) {
+        gen_uniforms_(&buffer_);
+        buffer_position_ = 0;
+      }
+      ran = buffer_[buffer_position_];
+      ++buffer_position_;
+    }
     cache_.load(ran);
   }
   DEBUG("ran: " << ran);
   return ran;
 }
 
+void Random::gen_uniforms_(std::vector<double> * uniforms) {
+  for (double& uniform : *uniforms) {
+    uniform = gen_uniform_();
+  }
+}
+
 int Random::uniform(const int min, const int max) {
   ASSERT(max >= min, "max:" << max << " must be > min:" << min);
   return static_cast<int>(uniform() * (max - min + 1)) + min;
 }
 
 void Random::serialize_random_(std::ostream& ostr) const {
-  feasst_serialize_version(979, ostr);
+  feasst_serialize_version(980, ostr);
   feasst_serialize_fstobj(cache_, ostr);
   feasst_serialize(is_seeded_, ostr);
+  feasst_serialize(buffer_, ostr);
+  feasst_serialize(buffer_position_, ostr);
 }
 
 std::map<std::string, std::shared_ptr<Random> >& Random::deserialize_map() {
@@ -87,9 +114,13 @@ std::shared_ptr<Random> Random::factory(const std::string name, argtype * args)
 Random::Random(std::istream& istr) {
   istr >> class_name_;
   const int version = feasst_deserialize_version(istr);
-  ASSERT(version == 979, "mismatch version: " << version);
+  ASSERT(version >= 979 && version <= 980, "mismatch version: " << version);
   feasst_deserialize_fstobj(&cache_, istr);
   feasst_deserialize(&is_seeded_, istr);
+  if (version >= 980) {
+    feasst_deserialize(&buffer_, istr);
+    feasst_deserialize(&buffer_position_, istr);
+  }
 }
 
 bool Random::coin_flip() {
@@ -186,6 +217,11 @@ int Random::index_from_cumulative_probability(
   return -1;
 }
 
+int Random::index_from_alias_table(const AliasTable& table) {
+  if (table.size() == 1) return 0;
+  return table.index(uniform());
+}
+
 RotationMatrix Random::rotation(const int dimension, const double tunable) {
   Position axis;
   RotationMatrix rot_mat;
@@ -9,6 +9,12 @@ int RandomMT19937::gen_uniform_(const int min, const int max) {
   return dis_int(generator_);
 }
 
+void RandomMT19937::gen_uniforms_(std::vector<double> * uniforms) {
+  for (double& uniform : *uniforms) {
+    uniform = dis_double_(generator_);
+  }
+}
+
 void RandomMT19937::reseed_(const int seed) {
 //  const int seed = rand();
   TRACE("seed " << seed << " address " << this);
@@ -0,0 +1,149 @@
+#include "math/include/random_philox.h"
+#include "utils/include/io.h"
+#include "utils/include/serialize.h"
+
+namespace feasst {
+
+namespace {
+
+const uint32_t PHILOX_M0 = 0xD2511F53;
+const uint32_t PHILOX_M1 = 0xCD9E8D57;
+const uint32_t PHILOX_W0 = 0x9E3779B9;
+const uint32_t PHILOX_W1 = 0xBB67AE85;
+
+inline void mulhilo(const uint32_t a, const uint32_t b,
+                    uint32_t * hi, uint32_t * lo) {
+  const uint64_t product = static_cast<uint64_t>(a)*static_cast<uint64_t>(b);
+  *hi = static_cast<uint32_t>(product >> 32);
+  *lo = static_cast<uint32_t>(product);
+}
+
+// Convert two 32-bit integers into a double in [0, 1) with 53 random bits.
+inline double to_uniform(const uint32_t high, const uint32_t low) {
+  const uint64_t bits = (static_cast<uint64_t>(high) << 32) | low;
+  return static_cast<double>(bits >> 11)*(1./9007199254740992.);
+}
+
+}  // namespace
+
+class MapRandomPhilox {
+ public:
+  MapRandomPhilox() {
+    RandomPhilox().deserialize_map()["RandomPhilox"] = MakeRandomPhilox();
+  }
+};
+
+static MapRandomPhilox mapper_ = MapRandomPhilox();
+
+RandomPhilox::RandomPhilox(argtype * args) : Random(args) {
+  class_name_ = "RandomPhilox";
+  stream_ = static_cast<uint32_t>(integer("stream", args, 0));
+  parse_seed_(args);
+}
+RandomPhilox::RandomPhilox(argtype args) : RandomPhilox(&args) {
+  FEASST_CHECK_ALL_USED(args);
+}
+
+void RandomPhilox::set_stream(const uint32_t stream) {
+  offset_ = offset();
+  clear_buffer_();
+  stream_ = stream;
+}
+
+void RandomPhilox::set_offset(const uint64_t offset) {
+  clear_buffer_();
+  offset_ = offset;
+}
+
+void RandomPhilox::reseed_(const int seed) {
+  TRACE("seed " << seed << " address " << this);
+  key_ = static_cast<uint32_t>(seed);
+  offset_ = 0;
+  is_block_ = false;
+}
+
+// Each block of the counter gives two uniform random numbers.
+void RandomPhilox::compute_block_(const uint64_t block_index,
+                                  double * uniforms) const {
+  uint32_t ctr[4] = {static_cast<uint32_t>(block_index),
+                     static_cast<uint32_t>(block_index >> 32),
+                     stream_,
+                     0};
+  uint32_t key[2] = {key_, 0};
+  uint32_t hi0, lo0, hi1, lo1;
+  for (int round = 0; round < 10; ++round) {
+    if (round > 0) {
+      key[0] += PHILOX_W0;
+      key[1] += PHILOX_W1;
+    }
+    mulhilo(PHILOX_M0, ctr[0], &hi0, &lo0);
+    mulhilo(PHILOX_M1, ctr[2], &hi1, &lo1);
+    ctr[0] = hi1 ^ ctr[1] ^ key[0];
+    ctr[1] = lo1;
+    ctr[2] = hi0 ^ ctr[3] ^ key[1];
+    ctr[3] = lo0;
+  }
+  uniforms[0] = to_uniform(ctr[0], ctr[1]);
+  uniforms[1] = to_uniform(ctr[2], ctr[3]);
+}
+
+double RandomPhilox::gen_uniform_() {
+  const uint64_t block_index = offset_/2;
+  if (!is_block_ || block_index != block_index_) {
+    compute_block_(block_index, block_);
+    block_index_ = block_index;
+    is_block_ = true;
+  }
+  const double uniform = block_[offset_ % 2];
+  ++offset_;
+  return uniform;
+}
+
+void RandomPhilox::fill_uniform(std::vector<double> * uniforms) {
+  // continue from the last uniform random number used
+  set_offset(offset());
+  gen_uniforms_(uniforms);
+}
+
+void RandomPhilox::gen_uniforms_(std::vector<double> * uniforms) {
+  const int num = static_cast<int>(uniforms->size());
+  int index = 0;
+  // finish a partially used block
+  while (index < num && offset_ % 2 != 0) {
+    (*uniforms)[index++] = gen_uniform_();
+  }
+  // generate whole blocks directly into the vector
+  double block[2];
+  while (index + 1 < num) {
+    compute_block_(offset_/2, block);
+    (*uniforms)[index++] = block[0];
+    (*uniforms)[index++] = block[1];
+    offset_ += 2;
+  }
+  if (index < num) {
+    (*uniforms)[index] = gen_uniform_();
+  }
+}
+
+void RandomPhilox::serialize(std::ostream& ostr) const {
+  ostr << class_name_ << " ";
+  serialize_random_(ostr);
+  feasst_serialize_version(4418, ostr);
+  feasst_serialize(key_, ostr);
+  feasst_serialize(stream_, ostr);
+  feasst_serialize(offset_, ostr);
+  feasst_serialize_endcap("RandomPhilox", ostr);
+}
+
+RandomPhilox::RandomPhilox(std::istream& istr)
+  : Random(istr) {
+  ASSERT(class_name_ == "RandomPhilox", "name: " << class_name_);
+  const int version = feasst_deserialize_version(istr);
+  ASSERT(version == 4418, "version: " << version);
+  feasst_deserialize(&key_, istr);
+  feasst_deserialize(&stream_, istr);
+  feasst_deserialize(&offset_, istr);
+  feasst_deserialize_endcap("RandomPhilox", istr);
+}
+
+}  // namespace feasst
@@ -0,0 +1,37 @@
+#include <cmath>
+#include "utils/test/utils.h"
+#include "math/include/alias_table.h"
+#include "math/include/random_mt19937.h"
+
+namespace feasst {
+
+TEST(AliasTable, probability) {
+  const std::vector<double> weights = {1., 0., 3., 2., 4.};
+  AliasTable table(weights);
+  EXPECT_EQ(5, table.size());
+  EXPECT_NEAR(0.3, table.probability(2), NEAR_ZERO);
+  EXPECT_NEAR(0., table.probability(1), NEAR_ZERO);
+  RandomMT19937 random(argtype({{"seed", "123"}}));
+  std::vector<double> count(weights.size(), 0.);
+  const int num = 1e5;
+  for (int i = 0; i < num; ++i) {
+    count[random.index_from_alias_table(table)] += 1.;
+  }
+  EXPECT_EQ(0., count[1]);
+  for (int index = 0; index < table.size(); ++index) {
+    const double prob = table.probability(index);
+    EXPECT_NEAR(prob, count[index]/num, 5.*std::sqrt(prob*(1. - prob)/num));
+  }
+
+  AliasTable table2 = test_serialize(table);
+  for (const double uniform : {0., 0.13, 0.5, 0.77, 0.999}) {
+    EXPECT_EQ(table.index(uniform), table2.index(uniform));
+  }
+
+  TRY(
+    AliasTable({0., 0.});
+    CATCH_PHRASE("must be > 0");
+  );
+}
+
+}  // namespace feasst
@@ -4,13 +4,15 @@
 #include "utils/test/utils.h"
 #include "math/include/random_modulo.h"
 #include "math/include/random_mt19937.h"
+#include "math/include/random_philox.h"
 #include "math/include/histogram.h"
 #include "math/include/accumulator.h"
 #include "math/include/matrix.h"
 
 namespace feasst {
 
-std::vector<std::shared_ptr<Random> > gens = {MakeRandomMT19937(), MakeRandomModulo()};
+std::vector<std::shared_ptr<Random> > gens = {MakeRandomMT19937(), MakeRandomModulo(),
+  MakeRandomPhilox()};
 //std::vector<std::shared_ptr<Random> > gens = {MakeRandomModulo()};
 
 TEST(Random, uniform) {
@@ -125,6 +127,30 @@ TEST(Random, index_from_cumulative_probability) {
   }
 }
 
+TEST(Random, buffer) {
+  for (std::shared_ptr<Random> random : gens) {
+    argtype args = {{"seed", "123"}};
+    std::shared_ptr<Random> buffered = random->factory(random->class_name(),
+                                                       &args);
+    args = {{"seed", "123"}, {"buffer_size", "1"}};
+    std::shared_ptr<Random> unbuffered = random->factory(random->class_name(),
+                                                         &args);
+    EXPECT_EQ(64, buffered->buffer_size());
+    EXPECT_EQ(0, unbuffered->buffer_size());
+    for (int i = 0; i < 100; ++i) {
+      EXPECT_EQ(buffered->uniform(), unbuffered->uniform());
+    }
+
+    // restart from the middle of the buffer
+    std::stringstream ss;
+    buffered->serialize(ss);
+    std::shared_ptr<Random> restart = buffered->deserialize(ss);
+    for (int i = 0; i < 100; ++i) {
+      EXPECT_EQ(buffered->uniform(), restart->uniform());
+    }
+  }
+}
+
 TEST(RandomModulo, compiler_independent) {
   auto random = MakeRandomModulo({{"seed", "1346867550"}});
 //  EXPECT_NEAR(random.uniform(), 0, NEAR_ZERO);
@@ -175,6 +201,44 @@ TEST(RandomMT19937, serialize) {
   );
 }
 
+TEST(RandomPhilox, serialize) {
+  RandomPhilox random(argtype({{"stream", "3"}}));
+  random.seed_by_time();
+  random.uniform();
+  RandomPhilox random2 = test_serialize(random);
+  EXPECT_EQ(3, static_cast<int>(random2.stream()));
+  EXPECT_EQ(1, static_cast<int>(random2.offset()));
+  const double next = random.uniform();
+  EXPECT_EQ(next, random2.uniform());
+}
+
+TEST(RandomPhilox, jump) {
+  auto random = MakeRandomPhilox({{"seed", "1346867550"}});
+  std::vector<double> uniforms;
+  for (int i = 0; i < 9; ++i) uniforms.push_back(random->uniform());
+  EXPECT_EQ(9, static_cast<int>(random->offset()));
+
+  // jump back to any offset in O(1)
+  random->set_offset(5);
+  EXPECT_EQ(uniforms[5], random->uniform());
+  random->set_offset(2);
+  EXPECT_EQ(uniforms[2], random->uniform());
+
+  // bulk generation is the same as successive calls
+  random->set_offset(1);
+  std::vector<double> bulk(7);
+  random->fill_uniform(&bulk);
+  for (int i = 0; i < 7; ++i) EXPECT_EQ(uniforms[i + 1], bulk[i]);
+  EXPECT_EQ(8, static_cast<int>(random->offset()));
+
+  // streams of the same seed are independent
+  auto random2 = MakeRandomPhilox({{"seed", "1346867550"}, {"stream", "1"}});
+  EXPECT_NE(uniforms[0], random2->uniform());
+  random2->set_stream(0);
+  random2->set_offset(0);
+  EXPECT_EQ(uniforms[0], random2->uniform());
+}
+
 TEST(Random, standard_normal) {
   for (std::shared_ptr<Random> random : gens) {
     random->seed_by_time();
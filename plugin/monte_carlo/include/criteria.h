@@ -158,6 +158,8 @@ class Criteria {
     const bool endpoint) {}
   void synchronize_(const Criteria& criteria) { data_ = criteria.data(); }
   const SynchronizeData& data() const { return data_; }
+  // Return true if all state is synchronized by the above.
+  virtual bool is_synchronize_complete() const { return false; }
 
   // HWH hackish adjust_bounds interface. See CollectionMatrixSplice.
   virtual int set_soft_max(const int index, const System& sys);
@@ -168,6 +170,11 @@ class Criteria {
     const bool all_min_size,
     const int min_size, const System& system, const System * upper_sys,
     Criteria * criteria, bool * adjusted_up, std::vector<int> * states);
+  virtual void shift_bounds(const bool left_most, const bool right_most,
+    const bool all_min_size,
+    const int min_size, const System& system, const System& upper_sys,
+    Criteria * criteria, bool * adjusted_up, std::vector<int> * states,
+    const int shift);
   virtual const Macrostate& macrostate() const;
   virtual int soft_max() const;
   virtual int soft_min() const;
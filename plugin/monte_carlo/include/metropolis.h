@@ -33,6 +33,8 @@ class Metropolis : public Criteria {
     Acceptance * acceptance,
     Random * random) override;
 
+  bool is_synchronize_complete() const override { return true; }
+
   std::shared_ptr<Criteria> create(std::istream& istr) const override {
     return std::make_shared<Metropolis>(istr); }
   std::shared_ptr<Criteria> create(argtype * args) const override {
@@ -143,6 +143,12 @@ class MonteCarlo {
     const bool all_min_size,
     const int min_size, MonteCarlo * mc);
 
+  // Same as above, but move a given number of macrostates from mc to this
+  // if positive, or from this to mc if negative.
+  void shift_bounds(const bool left_most, const bool right_most,
+    const bool all_min_size,
+    const int min_size, MonteCarlo * mc, const int shift);
+
   /// The fourth action is to set the Criteria.
   /// Configuration and Potentials (or System) must be set first.
   void set(std::shared_ptr<Criteria> criteria);
@@ -0,0 +1,77 @@
+#ifndef FEASST_MONTE_CARLO_PERTURB_ADD_CAVITY_H_
+#define FEASST_MONTE_CARLO_PERTURB_ADD_CAVITY_H_
+
+#include "monte_carlo/include/perturb_anywhere.h"
+
+namespace feasst {
+
+class VisitModelCell;
+
+/**
+  Return the VisitModelCell of the Potential with the given index, whose
+  empty cells define the cavities.
+ */
+const VisitModelCell& cavity_cells(const System& system,
+                                   const int potential_index);
+
+/**
+  Add a particle with its first site at a uniform random position inside a
+  uniform random cavity.
+  The cavities are the empty cells of the VisitModelCell of a Potential.
+  The cells are updated incrementally when trials are finalized.
+  Typically, the Potential is added solely for this purpose, with a ModelEmpty
+  and a cell length near the size of a particle.
+ */
+class PerturbAddCavity : public Perturb {
+ public:
+  /**
+    args:
+    - cavity_index: index of the Potential which defines the cavities.
+    - delay_add: If true, don't add particle until finalize (default: true).
+   */
+  explicit PerturbAddCavity(argtype args = argtype());
+  explicit PerturbAddCavity(argtype * args);
+
+  /// Return the index of the Potential which defines the cavities.
+  int cavity_index() const { return cavity_index_; }
+
+  /// Return if the particle isn't added until finalized.
+  bool delay_add() const { return delay_add_; }
+
+  void precompute(TrialSelect * select, System * system) override {
+    select->set_ghost(true); }
+
+  void before_select() override;
+
+  void perturb(
+      System * system,
+      TrialSelect * select,
+      Random * random,
+      const bool is_position_held = false) override;
+
+  void revert(System * system) override;
+  void finalize(System * system) override;
+
+  // serialize
+  std::shared_ptr<Perturb> create(std::istream& istr) const override;
+  void serialize(std::ostream& ostr) const override;
+  explicit PerturbAddCavity(std::istream& istr);
+  virtual ~PerturbAddCavity() {}
+
+ private:
+  int cavity_index_;
+  bool delay_add_;
+
+  // temporary
+  PerturbAnywhere anywhere_;
+  Position center_;
+};
+
+inline std::shared_ptr<PerturbAddCavity> MakePerturbAddCavity(
+    argtype args = argtype()) {
+  return std::make_shared<PerturbAddCavity>(args);
+}
+
+}  // namespace feasst
+
+#endif  // FEASST_MONTE_CARLO_PERTURB_ADD_CAVITY_H_
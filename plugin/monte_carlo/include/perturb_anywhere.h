@@ -21,6 +21,10 @@ class PerturbAnywhere : public PerturbMove {
   void move(const bool is_position_held, System * system, TrialSelect * select,
             Random * random) override;
 
+  /// Same as move, but set the particle position to center.
+  void move_to(const Position& center, System * system, TrialSelect * select,
+               Random * random);
+
   // serialize
   std::shared_ptr<Perturb> create(std::istream& istr) const override;
   void serialize(std::ostream& ostr) const override;
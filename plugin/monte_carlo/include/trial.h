@@ -181,8 +181,10 @@ class Trial {
   // temporary or duplicate
   Acceptance acceptance_;
   std::vector<TrialStage*> stages_ptr_;
+  int profile_section_ = -1;
 
   void refresh_stages_ptr_();
+  int profile_section_of_class_();
 };
 
 inline std::shared_ptr<Trial> MakeTrial(argtype args = argtype()) {
@@ -0,0 +1,82 @@
+#ifndef FEASST_MONTE_CARLO_TRIAL_COMPUTE_ADD_CAVITY_H_
+#define FEASST_MONTE_CARLO_TRIAL_COMPUTE_ADD_CAVITY_H_
+
+#include <memory>
+#include <vector>
+#include "utils/include/arguments.h"
+#include "system/include/system.h"
+#include "monte_carlo/include/criteria.h"
+#include "monte_carlo/include/trial_stage.h"
+#include "monte_carlo/include/trial_compute.h"
+
+namespace feasst {
+
+/**
+Attempt to add a particle into a cavity, as described in PerturbAddCavity.
+The derivation of the acceptance probability follows TrialComputeAdd, except
+that the particle is placed in one of the :math:`M` empty cells of volume
+:math:`v`, and the reverse removal is only possible if the first site of the
+particle is in an empty cell once the particle is removed.
+
+\rst
++-------------------------------------+----------------------------------------+
+|Forward event                        |Probability, :math:`\pi_{on}`           |
+|                                     |                                        |
+|[reverse event]                      |[reverse probability, :math:`\pi_{no}`] |
++-------------------------------------+----------------------------------------+
+|Select insert trial                  |:math:`1/w`                             |
+|                                     |                                        |
+|[Select remove trial]                |:math:`[1/w]`                           |
++-------------------------------------+----------------------------------------+
+|Place particle of type t in a cavity |:math:`1/(M v)`                         |
+|                                     |                                        |
+|[Delete particle type t]             |:math:`\left[\frac{1}{N_t+1}\right]`    |
++-------------------------------------+----------------------------------------+
+|Accept                               |:math:`min(1, \chi)`                    |
+|                                     |                                        |
+|[Accept]                             |:math:`[min(1, 1/\chi)]`                |
++-------------------------------------+----------------------------------------+
+
+:math:`\chi = \frac{M v e^{-\beta\Delta U + \beta\mu_t}}{(N_t+1)\Lambda^d}`
+
+For the deletion trial, :math:`M` is the number of empty cells after the
+particle is removed, and the trial is rejected if the first site of the
+particle is not in one of these cells.
+If there are no empty cells, the insertion is rejected.
+Only one Rosenbluth step is supported.
+\endrst
+ */
+class TrialComputeAddCavity : public TrialCompute {
+ public:
+  /**
+    args:
+    - cavity_index: index of the Potential which defines the cavities.
+   */
+  explicit TrialComputeAddCavity(argtype args = argtype());
+  explicit TrialComputeAddCavity(argtype * args);
+
+  void perturb_and_acceptance(
+      Criteria * criteria,
+      System * system,
+      Acceptance * acceptance,
+      std::vector<TrialStage*> * stages,
+      Random * random) override;
+
+  // serialize
+  std::shared_ptr<TrialCompute> create(std::istream& istr) const override;
+  void serialize(std::ostream& ostr) const override;
+  explicit TrialComputeAddCavity(std::istream& istr);
+  virtual ~TrialComputeAddCavity() {}
+
+ private:
+  int cavity_index_;
+};
+
+inline std::shared_ptr<TrialComputeAddCavity> MakeTrialComputeAddCavity(
+    argtype args = argtype()) {
+  return std::make_shared<TrialComputeAddCavity>(args);
+}
+
+}  // namespace feasst
+
+#endif  // FEASST_MONTE_CARLO_TRIAL_COMPUTE_ADD_CAVITY_H_
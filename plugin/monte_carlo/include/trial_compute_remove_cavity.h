@@ -0,0 +1,52 @@
+#ifndef FEASST_MONTE_CARLO_TRIAL_COMPUTE_REMOVE_CAVITY_H_
+#define FEASST_MONTE_CARLO_TRIAL_COMPUTE_REMOVE_CAVITY_H_
+
+#include <memory>
+#include <vector>
+#include "utils/include/arguments.h"
+#include "system/include/system.h"
+#include "monte_carlo/include/criteria.h"
+#include "monte_carlo/include/trial_stage.h"
+#include "monte_carlo/include/trial_compute.h"
+
+namespace feasst {
+
+/**
+  Attempt to remove a particle which is in a cavity.
+  See TrialComputeAddCavity for derivation of the acceptance probability that
+  is the reverse of this Trial.
+ */
+class TrialComputeRemoveCavity : public TrialCompute {
+ public:
+  /**
+    args:
+    - cavity_index: index of the Potential which defines the cavities.
+   */
+  explicit TrialComputeRemoveCavity(argtype args = argtype());
+  explicit TrialComputeRemoveCavity(argtype * args);
+
+  void perturb_and_acceptance(
+      Criteria * criteria,
+      System * system,
+      Acceptance * acceptance,
+      std::vector<TrialStage*> * stages,
+      Random * random) override;
+
+  // serialize
+  std::shared_ptr<TrialCompute> create(std::istream& istr) const override;
+  void serialize(std::ostream& ostr) const override;
+  explicit TrialComputeRemoveCavity(std::istream& istr);
+  virtual ~TrialComputeRemoveCavity() {}
+
+ private:
+  int cavity_index_;
+};
+
+inline std::shared_ptr<TrialComputeRemoveCavity> MakeTrialComputeRemoveCavity(
+    argtype args = argtype()) {
+  return std::make_shared<TrialComputeRemoveCavity>(args);
+}
+
+}  // namespace feasst
+
+#endif  // FEASST_MONTE_CARLO_TRIAL_COMPUTE_REMOVE_CAVITY_H_
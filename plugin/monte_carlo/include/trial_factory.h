@@ -2,8 +2,10 @@
 #ifndef FEASST_MONTE_CARLO_TRIAL_FACTORY_H_
 #define FEASST_MONTE_CARLO_TRIAL_FACTORY_H_
 
+#include <chrono>
 #include <sstream>
 #include <memory>
+#include "math/include/alias_table.h"
 #include "monte_carlo/include/trial.h"
 // #include "utils/include/timer.h"
 
@@ -23,6 +25,9 @@ class TrialFactory : public Trial {
   /// Remove a trial by index.
   void remove(const int index);
 
+  /// Set the weight of a trial by index.
+  void set_trial_weight(const int index, const double weight);
+
   /// Return the number of trials.
   int num() const { return static_cast<int>(trials_.size()); }
 
@@ -54,6 +59,17 @@ class TrialFactory : public Trial {
   /// Return the index of the last trial attempted.
   int last_index() const { return last_index_; }
 
+  /**
+    Measure the wall time of the next attempt only.
+    A Modify which requires the time of each attempt should call this every
+    update, so that the timing stops when it is removed.
+   */
+  void time_next_attempt() { is_timed_ = true; }
+
+  /// Return the wall time, in seconds, of the last attempt if it was timed.
+  /// Otherwise, return zero.
+  double last_seconds() const { return last_seconds_; }
+
   /// Return the cumulative probability of each trial.
   const std::vector<double>& cumulative_probability() const {
     return cumulative_probability_; }
@@ -105,6 +121,9 @@ class TrialFactory : public Trial {
 
   // not to be serialized
   int last_index_ = -1;
+  AliasTable alias_table_;
+  bool is_timed_ = false;
+  double last_seconds_ = 0.;
 //  Timer timer_;
 
   void update_cumul_prob_();
@@ -86,6 +86,12 @@ class TrialStage {
     const int old,
     Random * random);
 
+  /// Perturb without the computation of energies or Rosenbluth factors.
+  /// This is intended for perturbations which do not change the energy,
+  /// such as a change in the inverse temperature.
+  /// Set sites involved in stage as physical.
+  void perturb_only(System * system, Random * random);
+
   /// Call between multiple attempts (e.g., old vs new)
   /// Set mobile sites unphysical.
   void mid_stage(System * system);
@@ -0,0 +1,72 @@
+#ifndef FEASST_MONTE_CARLO_TRIAL_TRANSFER_CAVITY_H_
+#define FEASST_MONTE_CARLO_TRIAL_TRANSFER_CAVITY_H_
+
+#include <memory>
+#include "utils/include/arguments.h"
+#include "monte_carlo/include/trial_factory.h"
+
+namespace feasst {
+
+/**
+  Attempt to add a particle into a cavity, as described in
+  TrialComputeAddCavity.
+
+  args:
+  - cavity_index: index of the Potential whose VisitModelCell defines the
+    cavities (default: 0).
+    For example, add a Potential with ModelEmpty and
+    VisitModelCell with a min_length near the size of a particle.
+ */
+class TrialAddCavity : public Trial {
+ public:
+  explicit TrialAddCavity(argtype args = argtype());
+  explicit TrialAddCavity(argtype * args);
+  std::shared_ptr<Trial> create(std::istream& istr) const override {
+    return std::make_shared<TrialAddCavity>(istr); }
+  std::shared_ptr<Trial> create(argtype * args) const override {
+    return std::make_shared<TrialAddCavity>(args); }
+  void serialize(std::ostream& ostr) const override;
+  explicit TrialAddCavity(std::istream& istr);
+  virtual ~TrialAddCavity() {}
+};
+
+inline std::shared_ptr<TrialAddCavity> MakeTrialAddCavity(
+    argtype args = argtype()) {
+  return std::make_shared<TrialAddCavity>(args); }
+
+/// Attempt to remove a particle in a cavity, as described in
+/// TrialComputeRemoveCavity, with the same arguments as TrialAddCavity.
+class TrialRemoveCavity : public Trial {
+ public:
+  explicit TrialRemoveCavity(argtype args = argtype());
+  explicit TrialRemoveCavity(argtype * args);
+  std::shared_ptr<Trial> create(std::istream& istr) const override {
+    return std::make_shared<TrialRemoveCavity>(istr); }
+  std::shared_ptr<Trial> create(argtype * args) const override {
+    return std::make_shared<TrialRemoveCavity>(args); }
+  void serialize(std::ostream& ostr) const override;
+  explicit TrialRemoveCavity(std::istream& istr);
+  virtual ~TrialRemoveCavity() {}
+};
+
+inline std::shared_ptr<TrialRemoveCavity> MakeTrialRemoveCavity(
+    argtype args = argtype()) {
+  return std::make_shared<TrialRemoveCavity>(args); }
+
+/// Attempt TrialAddCavity or TrialRemoveCavity with equal probability.
+class TrialTransferCavity : public TrialFactoryNamed {
+ public:
+  explicit TrialTransferCavity(argtype args = argtype());
+  explicit TrialTransferCavity(argtype * args);
+  std::shared_ptr<TrialFactoryNamed> create(argtype * args) const override {
+    return std::make_shared<TrialTransferCavity>(args); }
+  virtual ~TrialTransferCavity() {}
+};
+
+inline std::shared_ptr<TrialTransferCavity> MakeTrialTransferCavity(
+    argtype args = argtype()) {
+  return std::make_shared<TrialTransferCavity>(args); }
+
+}  // namespace feasst
+
+#endif  // FEASST_MONTE_CARLO_TRIAL_TRANSFER_CAVITY_H_
@@ -270,6 +270,14 @@ void Criteria::adjust_bounds(const bool left_most, const bool right_most,
   FATAL("not implemented");
 }
 
+void Criteria::shift_bounds(const bool left_most, const bool right_most,
+  const bool all_min_size,
+  const int min_size, const System& system, const System& upper_sys,
+  Criteria * criteria, bool * adjusted_up, std::vector<int> * states,
+  const int shift) {
+  FATAL("not implemented");
+}
+
 const Macrostate& Criteria::macrostate() const { FATAL("not implemented"); }
 int Criteria::soft_min() const { FATAL("not implemented"); }
 int Criteria::soft_max() const { FATAL("not implemented"); }
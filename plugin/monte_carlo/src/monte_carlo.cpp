@@ -677,6 +677,19 @@ void MonteCarlo::adjust_bounds(const bool left_most, const bool right_most,
   }
 }
 
+void MonteCarlo::shift_bounds(const bool left_most, const bool right_most,
+  const bool all_min_size,
+  const int min_size, MonteCarlo * mc, const int shift) {
+  bool adjusted_up;
+  std::vector<int> states;
+  criteria_->shift_bounds(left_most, right_most, all_min_size, min_size,
+    system_, mc->system(), mc->get_criteria(), &adjusted_up, &states, shift);
+  DEBUG("adjusted_up " << adjusted_up);
+  DEBUG("states: " << feasst_str(states));
+  analyze_factory_.adjust_bounds(adjusted_up, states, mc->get_analyze_factory());
+  modify_factory_.adjust_bounds(adjusted_up, states, mc->get_modify_factory());
+}
+
 void MonteCarlo::ghost_trial_(
     const double ln_prob,
     const int state_old,
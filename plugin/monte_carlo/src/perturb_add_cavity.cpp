@@ -0,0 +1,103 @@
+#include "utils/include/serialize.h"
+#include "configuration/include/domain.h"
+#include "system/include/visit_model_cell.h"
+#include "monte_carlo/include/perturb_add_cavity.h"
+
+namespace feasst {
+
+const VisitModelCell& cavity_cells(const System& system,
+                                   const int potential_index) {
+  ASSERT(potential_index >= 0 &&
+         potential_index < system.potentials().num(),
+    "cavity_index: " << potential_index << " is not a Potential index");
+  const VisitModel& visit = system.potential(potential_index).visit_model();
+  ASSERT(visit.class_name() == "VisitModelCell",
+    "The Potential of cavity_index: " << potential_index << " requires " <<
+    "VisitModelCell. Found: " << visit.class_name());
+  return static_cast<const VisitModelCell&>(visit);
+}
+
+PerturbAddCavity::PerturbAddCavity(argtype args) : PerturbAddCavity(&args) {
+  FEASST_CHECK_ALL_USED(args);
+}
+PerturbAddCavity::PerturbAddCavity(argtype * args) : Perturb(args) {
+  class_name_ = "PerturbAddCavity";
+  cavity_index_ = integer("cavity_index", args, 0);
+  delay_add_ = boolean("delay_add", args, true);
+  disable_tunable_();
+}
+
+class MapPerturbAddCavity {
+ public:
+  MapPerturbAddCavity() {
+    auto obj = MakePerturbAddCavity();
+    obj->deserialize_map()["PerturbAddCavity"] = obj;
+  }
+};
+
+static MapPerturbAddCavity mapper_ = MapPerturbAddCavity();
+
+std::shared_ptr<Perturb> PerturbAddCavity::create(std::istream& istr) const {
+  return std::make_shared<PerturbAddCavity>(istr);
+}
+
+void PerturbAddCavity::before_select() {
+  Perturb::before_select();
+  anywhere_.before_select();
+}
+
+void PerturbAddCavity::perturb(
+    System * system,
+    TrialSelect * select,
+    Random * random,
+    const bool is_position_held) {
+  Configuration * config = select->get_configuration(system);
+  if (!delay_add_) config->revive(select->mobile());
+  if (!is_position_held) {
+    cavity_cells(*system, cavity_index_).random_position_in_empty_cell(
+      config->domain(), random, &center_);
+    anywhere_.move_to(center_, system, select, random);
+    anywhere_.set_revert_possible(true, select);
+  }
+  set_revert_possible(true, select);
+  set_finalize_possible(true, select);
+  // setting trial state should go last so other perturbs do not overwrite
+  select->set_trial_state(3);
+}
+
+void PerturbAddCavity::revert(System * system) {
+  if (revert_possible()) {
+    anywhere_.revert(system);
+    if (!delay_add_) {
+      revert_select()->get_configuration(system)->remove_particles(
+        revert_select()->mobile());
+    }
+  }
+}
+
+void PerturbAddCavity::finalize(System * system) {
+  if (finalize_possible()) {
+    if (delay_add_) {
+      finalize_select()->get_configuration(system)->revive(
+        finalize_select()->mobile());
+    }
+  }
+}
+
+PerturbAddCavity::PerturbAddCavity(std::istream& istr) : Perturb(istr) {
+  ASSERT(class_name_ == "PerturbAddCavity", "name: " << class_name_);
+  const int version = feasst_deserialize_version(istr);
+  ASSERT(version == 5192, "mismatch version: " << version);
+  feasst_deserialize(&cavity_index_, istr);
+  feasst_deserialize(&delay_add_, istr);
+}
+
+void PerturbAddCavity::serialize(std::ostream& ostr) const {
+  ostr << class_name_ << " ";
+  serialize_perturb_(ostr);
+  feasst_serialize_version(5192, ostr);
+  feasst_serialize(cavity_index_, ostr);
+  feasst_serialize(delay_add_, ostr);
+}
+
+}  // namespace feasst
@@ -46,6 +46,14 @@ void PerturbAnywhere::move(const bool is_position_held,
   DEBUG("anywhere: " << random_in_box_.str());
 }
 
+void PerturbAnywhere::move_to(const Position& center,
+                              System * system,
+                              TrialSelect * select,
+                              Random * random) {
+  rotate_.move(false, system, select, random);
+  set_position(center, system, select);
+}
+
 std::shared_ptr<Perturb> PerturbAnywhere::create(std::istream& istr) const {
   return std::make_shared<PerturbAnywhere>(istr);
 }
@@ -67,6 +67,8 @@ void Rosenbluth::compute(const double beta, Random * random, const bool old) {
   if (old) {
     chosen_step_ = 0;
   } else {
+    // Each set of steps is sampled only once, so a linear search of the
+    // cumulative probability is faster than building an AliasTable.
     chosen_step_ = random->index_from_cumulative_probability(cumulative_);
   }
   TRACE("chosen_step_ " << chosen_step_);
@@ -1,6 +1,7 @@
 #include <string>
 #include <memory>
 #include "utils/include/serialize.h"
+#include "utils/include/profile.h"
 #include "math/include/random.h"
 #include "configuration/include/domain.h"
 #include "monte_carlo/include/trial.h"
@@ -133,7 +134,17 @@ void Trial::finalize(System * system, Criteria * criteria) {
   criteria->finalize(acceptance_);
 }
 
+// The name of the Profile section depends upon the derived class, so it is
+// registered once per Trial instead of once per call site.
+int Trial::profile_section_of_class_() {
+  if (profile_section_ == -1) {
+    profile_section_ = Profile::section(class_name());
+  }
+  return profile_section_;
+}
+
 bool Trial::attempt(Criteria * criteria, System * system, Random * random) {
+  FEASST_PROFILE_SECTION(profile_section_of_class_());
   DEBUG("**********************************************************");
   DEBUG("* " << class_name() << " " << description() << " attempt " << num_attempts() << " *");
   DEBUG("**********************************************************");
@@ -156,16 +167,20 @@ bool Trial::attempt(Criteria * criteria, System * system, Random * random) {
   before_select(&acceptance_, criteria);
 
   // Perform selections. If one selection fails, do not continue selecting.
-  for (TrialStage * stage : stages_ptr_) {
-    stage->before_select();
-    DEBUG("selecting");
-    if (!acceptance_.reject()) {
-      stage->select(system, &acceptance_, random);
+  {
+    FEASST_PROFILE("select");
+    for (TrialStage * stage : stages_ptr_) {
+      stage->before_select();
+      DEBUG("selecting");
+      if (!acceptance_.reject()) {
+        stage->select(system, &acceptance_, random);
+      }
     }
   }
   if (acceptance_.reject()) {
     DEBUG("auto rejected at selection");
   } else {
+    FEASST_PROFILE("perturb");
     for (TrialStage * stage : stages_ptr_) {
       stage->set_mobile_physical(false, system);
     }
@@ -177,16 +192,23 @@ bool Trial::attempt(Criteria * criteria, System * system, Random * random) {
     DEBUG("auto reject");
     *num_auto_reject_() += 1;
   }
-  if (criteria->is_accepted(*system, &acceptance_, random)) {
+  bool accepted;
+  {
+    FEASST_PROFILE("acceptance");
+    accepted = criteria->is_accepted(*system, &acceptance_, random);
+  }
+  if (accepted) {
     DEBUG("accepted");
     increment_num_success_();
     DEBUG("is_finalize_delayed_ " << is_finalize_delayed_);
     if (!is_finalize_delayed_) {
+      FEASST_PROFILE("finalize");
       finalize(system, criteria);
     }
     return true;
   } else {
     DEBUG("rejected");
+    FEASST_PROFILE("revert");
     revert(system, criteria);
     if (!is_finalize_delayed_) {
       criteria->revert(acceptance_);
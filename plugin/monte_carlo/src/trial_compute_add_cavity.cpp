@@ -0,0 +1,88 @@
+#include <cmath>
+#include "utils/include/serialize.h"
+#include "configuration/include/domain.h"
+#include "system/include/visit_model_cell.h"
+#include "monte_carlo/include/trial_select.h"
+#include "monte_carlo/include/perturb_add_cavity.h"
+#include "monte_carlo/include/trial_compute_add_cavity.h"
+
+namespace feasst {
+
+TrialComputeAddCavity::TrialComputeAddCavity(argtype args)
+  : TrialComputeAddCavity(&args) {
+  FEASST_CHECK_ALL_USED(args);
+}
+TrialComputeAddCavity::TrialComputeAddCavity(argtype * args)
+  : TrialCompute(args) {
+  class_name_ = "TrialComputeAddCavity";
+  cavity_index_ = integer("cavity_index", args, 0);
+}
+
+class MapTrialComputeAddCavity {
+ public:
+  MapTrialComputeAddCavity() {
+    auto obj = MakeTrialComputeAddCavity();
+    obj->deserialize_map()["TrialComputeAddCavity"] = obj;
+  }
+};
+
+static MapTrialComputeAddCavity mapper_ = MapTrialComputeAddCavity();
+
+void TrialComputeAddCavity::perturb_and_acceptance(
+    Criteria * criteria,
+    System * system,
+    Acceptance * acceptance,
+    std::vector<TrialStage*> * stages,
+    Random * random) {
+  DEBUG("TrialComputeAddCavity");
+  const int iconf = stages->front()->select().configuration_index();
+  const Configuration& config = system->configuration(iconf);
+  const VisitModelCell& cavity = cavity_cells(*system, cavity_index_);
+  const int num_empty = cavity.cells().num_empty();
+  if (num_empty == 0) {
+    DEBUG("no cavities");
+    acceptance->set_reject(true);
+    for (TrialStage* stage : *stages) {
+      stage->set_mobile_physical(true, system);
+    }
+    return;
+  }
+  compute_rosenbluth(0, criteria, system, acceptance, stages, random);
+  acceptance->add_to_energy_new(criteria->current_energy(iconf), iconf);
+  acceptance->add_to_energy_profile_new(criteria->current_energy_profile(iconf), iconf);
+  acceptance->add_to_macrostate_shift(1, iconf);
+  { // Metropolis
+    const double volume = num_empty*cavity.cell_volume(config.domain());
+    const TrialSelect& select = (*stages)[0]->trial_select();
+    const int particle_index = select.mobile().particle_index(0);
+    const int particle_type = config.select_particle(particle_index).type();
+    acceptance->set_macrostate_shift_type(particle_type, iconf);
+    const double prob = 1./(config.num_particles_of_type(particle_type) + 1);
+    DEBUG("cavity volume " << volume << " prob " << prob);
+    acceptance->add_to_ln_metropolis_prob(
+      std::log(volume*prob)
+      + system->thermo_params().beta_mu(particle_type)
+    );
+  }
+}
+
+std::shared_ptr<TrialCompute> TrialComputeAddCavity::create(
+    std::istream& istr) const {
+  return std::make_shared<TrialComputeAddCavity>(istr);
+}
+
+TrialComputeAddCavity::TrialComputeAddCavity(std::istream& istr)
+  : TrialCompute(istr) {
+  const int version = feasst_deserialize_version(istr);
+  ASSERT(version == 7361, "mismatch version: " << version);
+  feasst_deserialize(&cavity_index_, istr);
+}
+
+void TrialComputeAddCavity::serialize(std::ostream& ostr) const {
+  ostr << class_name_ << " ";
+  serialize_trial_compute_(ostr);
+  feasst_serialize_version(7361, ostr);
+  feasst_serialize(cavity_index_, ostr);
+}
+
+}  // namespace feasst
@@ -0,0 +1,90 @@
+#include <cmath>
+#include "utils/include/serialize.h"
+#include "configuration/include/domain.h"
+#include "system/include/visit_model_cell.h"
+#include "monte_carlo/include/trial_select.h"
+#include "monte_carlo/include/perturb_add_cavity.h"
+#include "monte_carlo/include/trial_compute_remove_cavity.h"
+
+namespace feasst {
+
+TrialComputeRemoveCavity::TrialComputeRemoveCavity(argtype args)
+  : TrialComputeRemoveCavity(&args) {
+  FEASST_CHECK_ALL_USED(args);
+}
+TrialComputeRemoveCavity::TrialComputeRemoveCavity(argtype * args)
+  : TrialCompute(args) {
+  class_name_ = "TrialComputeRemoveCavity";
+  cavity_index_ = integer("cavity_index", args, 0);
+}
+
+class MapTrialComputeRemoveCavity {
+ public:
+  MapTrialComputeRemoveCavity() {
+    auto obj = MakeTrialComputeRemoveCavity();
+    obj->deserialize_map()["TrialComputeRemoveCavity"] = obj;
+  }
+};
+
+static MapTrialComputeRemoveCavity mapper_ = MapTrialComputeRemoveCavity();
+
+void TrialComputeRemoveCavity::perturb_and_acceptance(
+    Criteria * criteria,
+    System * system,
+    Acceptance * acceptance,
+    std::vector<TrialStage*> * stages,
+    Random * random) {
+  DEBUG("TrialComputeRemoveCavity");
+  const int iconf = stages->front()->select().configuration_index();
+  const Configuration& config = system->configuration(iconf);
+  const VisitModelCell& cavity = cavity_cells(*system, cavity_index_);
+  const TrialSelect& select = (*stages)[0]->trial_select();
+  const int particle_index = select.mobile().particle_index(0);
+  const Position& position = config.select_particle(particle_index).site(
+    select.mobile().site_index(0, 0)).position();
+  if (!cavity.is_empty_without(position, particle_index, config)) {
+    DEBUG("not in a cavity");
+    acceptance->set_reject(true);
+    for (TrialStage* stage : *stages) {
+      stage->set_mobile_physical(true, system);
+    }
+    return;
+  }
+  const int num_empty = cavity.num_empty_without(particle_index, config);
+  compute_rosenbluth(1, criteria, system, acceptance, stages, random);
+  acceptance->set_energy_new(criteria->current_energy(iconf) - acceptance->energy_old(iconf), iconf);
+  acceptance->set_energy_profile_new(criteria->current_energy_profile(iconf), iconf);
+  acceptance->subtract_from_energy_profile_new(acceptance->energy_profile_old(iconf), iconf);
+  acceptance->add_to_macrostate_shift(-1, iconf);
+  { // Metropolis
+    const double volume = num_empty*cavity.cell_volume(config.domain());
+    const int particle_type = config.select_particle(particle_index).type();
+    acceptance->set_macrostate_shift_type(particle_type, iconf);
+    DEBUG("cavity volume " << volume << " selprob " << select.probability());
+    acceptance->add_to_ln_metropolis_prob(
+      - std::log(volume*select.probability())
+      - system->thermo_params().beta_mu(particle_type)
+    );
+  }
+}
+
+std::shared_ptr<TrialCompute> TrialComputeRemoveCavity::create(
+    std::istream& istr) const {
+  return std::make_shared<TrialComputeRemoveCavity>(istr);
+}
+
+TrialComputeRemoveCavity::TrialComputeRemoveCavity(std::istream& istr)
+  : TrialCompute(istr) {
+  const int version = feasst_deserialize_version(istr);
+  ASSERT(version == 4297, "mismatch version: " << version);
+  feasst_deserialize(&cavity_index_, istr);
+}
+
+void TrialComputeRemoveCavity::serialize(std::ostream& ostr) const {
+  ostr << class_name_ << " ";
+  serialize_trial_compute_(ostr);
+  feasst_serialize_version(4297, ostr);
+  feasst_serialize(cavity_index_, ostr);
+}
+
+}  // namespace feasst
@@ -34,12 +34,20 @@ void TrialFactory::update_cumul_prob_() {
   }
   if (weights.size() > 0) {
     cumulative_probability_ = feasst::cumulative_probability(weights);
+    alias_table_.set_weights(weights);
   }
   //std::stringstream ss;
   //ss << trials_.back()->class_name()"trial" << num() - 1;
   // timer_.add(trials_.back()->class_name());
 }
 
+void TrialFactory::set_trial_weight(const int index, const double weight) {
+  ASSERT(index < num(),
+    "Trial index:" << index << " >= number of trials:" << num());
+  trials_[index]->set_weight(weight);
+  update_cumul_prob_();
+}
+
 void TrialFactory::remove(const int index) {
   ASSERT(index < num(),
     "Trial index:" << index << " >= number of trials:" << num());
@@ -49,7 +57,7 @@ void TrialFactory::remove(const int index) {
 
 int TrialFactory::random_index(Random * random) {
   ASSERT(num() > 0, "no trials to select");
-  return random->index_from_cumulative_probability(cumulative_probability_);
+  return random->index_from_alias_table(alias_table_);
 }
 
 bool TrialFactory::attempt(
@@ -65,7 +73,18 @@ bool TrialFactory::attempt(
   }
   last_index_ = trial_index;
   //timer_.start(index + 1);  // +1 for "other"
-  const bool accepted = trials_[trial_index]->attempt(criteria, system, random);
+  bool accepted;
+  if (is_timed_) {
+    const std::chrono::steady_clock::time_point begin =
+      std::chrono::steady_clock::now();
+    accepted = trials_[trial_index]->attempt(criteria, system, random);
+    last_seconds_ = std::chrono::duration<double>(
+      std::chrono::steady_clock::now() - begin).count();
+    is_timed_ = false;
+  } else {
+    accepted = trials_[trial_index]->attempt(criteria, system, random);
+    last_seconds_ = 0.;
+  }
   //timer_.end();
   if (accepted) increment_num_success_();
   return accepted;
@@ -175,6 +194,7 @@ TrialFactory::TrialFactory(std::istream& istr) : Trial(istr) {
     }
   }
   feasst_deserialize(&cumulative_probability_, istr);
+  update_cumul_prob_();
 }
 
 void TrialFactory::serialize_trial_factory_(std::ostream& ostr) const {
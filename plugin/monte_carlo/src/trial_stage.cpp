@@ -70,6 +70,13 @@ void TrialStage::set_rosenbluth_energy_(const int step, System * system) {
   rosenbluth_.set_energy_profile(step, system->stored_energy_profile(config));
 }
 
+void TrialStage::perturb_only(System * system, Random * random) {
+  ASSERT(perturb_, "perturb not set");
+  set_mobile_physical(true, system);
+  select_->zero_exclude_energy();
+  perturb_->perturb(system, select_.get(), random, false);
+}
+
 void TrialStage::attempt(System * system,
     Acceptance * acceptance,
     Criteria * criteria,
@@ -0,0 +1,114 @@
+#include "utils/include/serialize.h"
+#include "monte_carlo/include/trial_select_particle.h"
+#include "monte_carlo/include/perturb_remove.h"
+#include "monte_carlo/include/perturb_add_cavity.h"
+#include "monte_carlo/include/trial_compute_add_cavity.h"
+#include "monte_carlo/include/trial_compute_remove_cavity.h"
+#include "monte_carlo/include/trial_transfer_cavity.h"
+
+namespace feasst {
+
+class MapTrialAddCavity {
+ public:
+  MapTrialAddCavity() {
+    auto obj = MakeTrialAddCavity();
+    obj->deserialize_map()["TrialAddCavity"] = obj;
+  }
+};
+
+static MapTrialAddCavity mapper_ = MapTrialAddCavity();
+
+TrialAddCavity::TrialAddCavity(argtype * args) : Trial(args) {
+  class_name_ = "TrialAddCavity";
+  set_description("TrialAddCavity");
+  const std::string cavity_index = str("cavity_index", args, "0");
+  args->insert({"cavity_index", cavity_index});
+  auto perturb = std::make_shared<PerturbAddCavity>(args);
+  ASSERT(perturb->delay_add(),
+    "TrialComputeAddCavity assumes delay_add is true");
+  add_stage(std::make_shared<TrialSelectParticle>(args), perturb, args);
+  ASSERT(stage(0).num_steps() == 1, "TrialAddCavity requires num_steps=1");
+  set(MakeTrialComputeAddCavity({{"cavity_index", cavity_index}}));
+}
+TrialAddCavity::TrialAddCavity(argtype args) : TrialAddCavity(&args) {
+  FEASST_CHECK_ALL_USED(args);
+}
+
+TrialAddCavity::TrialAddCavity(std::istream& istr) : Trial(istr) {
+  const int version = feasst_deserialize_version(istr);
+  ASSERT(version == 8243, "mismatch version: " << version);
+}
+
+void TrialAddCavity::serialize(std::ostream& ostr) const {
+  ostr << class_name_ << " ";
+  serialize_trial_(ostr);
+  feasst_serialize_version(8243, ostr);
+}
+
+class MapTrialRemoveCavity {
+ public:
+  MapTrialRemoveCavity() {
+    auto obj = MakeTrialRemoveCavity();
+    obj->deserialize_map()["TrialRemoveCavity"] = obj;
+  }
+};
+
+static MapTrialRemoveCavity mapper_trial_remove_cavity_ =
+  MapTrialRemoveCavity();
+
+TrialRemoveCavity::TrialRemoveCavity(argtype * args) : Trial(args) {
+  class_name_ = "TrialRemoveCavity";
+  set_description("TrialRemoveCavity");
+  const std::string cavity_index = str("cavity_index", args, "0");
+  add_stage(
+    std::make_shared<TrialSelectParticle>(args),
+    std::make_shared<PerturbRemove>(),
+    args);
+  ASSERT(stage(0).num_steps() == 1,
+    "TrialRemoveCavity requires num_steps=1");
+  set(MakeTrialComputeRemoveCavity({{"cavity_index", cavity_index}}));
+}
+TrialRemoveCavity::TrialRemoveCavity(argtype args)
+  : TrialRemoveCavity(&args) {
+  FEASST_CHECK_ALL_USED(args);
+}
+
+TrialRemoveCavity::TrialRemoveCavity(std::istream& istr) : Trial(istr) {
+  const int version = feasst_deserialize_version(istr);
+  ASSERT(version == 2716, "mismatch version: " << version);
+}
+
+void TrialRemoveCavity::serialize(std::ostream& ostr) const {
+  ostr << class_name_ << " ";
+  serialize_trial_(ostr);
+  feasst_serialize_version(2716, ostr);
+}
+
+class MapTrialTransferCavity {
+ public:
+  MapTrialTransferCavity() {
+    auto obj = MakeTrialTransferCavity();
+    obj->deserialize_map()["TrialTransferCavity"] = obj;
+  }
+};
+
+static MapTrialTransferCavity mapper_trial_transfer_cavity_ =
+  MapTrialTransferCavity();
+
+TrialTransferCavity::TrialTransferCavity(argtype * args)
+  : TrialFactoryNamed() {
+  class_name_ = "TrialTransferCavity";
+  argtype orig_args = *args;
+  auto trial_add = std::make_shared<TrialAddCavity>(args);
+  trial_add->set_weight(trial_add->weight()/2.);
+  add(trial_add);
+  auto trial_remove = MakeTrialRemoveCavity(orig_args);
+  trial_remove->set_weight(trial_remove->weight()/2.);
+  add(trial_remove);
+}
+TrialTransferCavity::TrialTransferCavity(argtype args)
+  : TrialTransferCavity(&args) {
+  FEASST_CHECK_ALL_USED(args);
+}
+
+}  // namespace feasst
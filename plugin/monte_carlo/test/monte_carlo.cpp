@@ -264,6 +264,69 @@ TEST(MonteCarlo, NVT_SRSW) {
   EXPECT_LE(mc.modify(0).accumulator().average(), 1e-13);
 }
 
+// The throughput objective increases a step that is too small and decreases
+// a step that is too large for a dense fluid.
+TEST(MonteCarlo, tune_throughput) {
+  for (const double initial : {0.01, 3.9}) {
+    MonteCarlo mc;
+    mc.set(MakeRandomMT19937({{"seed", "123"}}));
+    mc.add(MakeConfiguration({{"cubic_side_length", "8"}, {"particle_type0", "../particle/lj.fstprt"}}));
+    mc.add(MakePotential(MakeLennardJones()));
+    mc.set(MakeThermoParams({{"beta", "1.2"}, {"chemical_potential", "10."}}));
+    mc.set(MakeMetropolis());
+    mc.add(MakeTrialTranslate({{"weight", "1."}, {"tunable_param", "1."}}));
+    mc.add(MakeTrialAdd({{"particle_type", "0"}}));
+    mc.run(MakeRun({{"until_num_particles", "300"}}));
+    mc.run(MakeRemoveTrial({{"name", "TrialAdd"}}));
+    mc.get_trial_factory()->set_tunable(0, initial);
+    mc.add(MakeTune({{"objective", "throughput"}, {"trials_per_tune", "100"}}));
+    mc.attempt(1e4);
+    const double value = mc.trial(0).stage(0).perturb().tunable().value();
+    if (initial < 1.) {
+      EXPECT_GT(value, 2.*initial);
+    } else {
+      EXPECT_LT(value, 0.5*initial);
+    }
+    MonteCarlo mc2 = test_serialize(mc);
+    EXPECT_EQ(value, mc2.trial(0).stage(0).perturb().tunable().value());
+  }
+  TRY(
+    MakeTune({{"objective", "speed"}});
+    CATCH_PHRASE("unrecognized objective");
+  );
+}
+
+// Without any accepted trials, the throughput objective decreases the step.
+// Any translation of a pair at the minimum of the potential is rejected.
+TEST(MonteCarlo, tune_throughput_reject) {
+  MonteCarlo mc;
+  mc.set(MakeRandomMT19937({{"seed", "123"}}));
+  mc.add(MakeConfiguration({{"cubic_side_length", "8"},
+                            {"particle_type0", "../particle/lj.fstprt"},
+                            {"add_particles_of_type0", "2"}}));
+  mc.get_system()->get_configuration()->update_positions(
+    {{0, 0, 0}, {std::pow(2., 1./6.), 0, 0}});
+  mc.add(MakePotential(MakeLennardJones()));
+  mc.set(MakeThermoParams({{"beta", "1e9"}}));
+  mc.set(MakeMetropolis());
+  mc.add(MakeTrialTranslate({{"tunable_param", "2."}}));
+  mc.add(MakeTune({{"objective", "throughput"}, {"trials_per_tune", "100"}}));
+  double previous = 2.;
+  for (int tune = 0; tune < 5; ++tune) {
+    mc.attempt(100);
+    const double value = mc.trial(0).stage(0).perturb().tunable().value();
+    EXPECT_LT(value, previous);
+    previous = value;
+  }
+  EXPECT_EQ(0, mc.trial(0).num_success());
+
+  // trials are only timed while Tune is attached
+  EXPECT_GT(mc.trials().last_seconds(), 0.);
+  mc.run(MakeRemoveModify({{"name", "Tune"}}));
+  mc.attempt(2);
+  EXPECT_EQ(0., mc.trials().last_seconds());
+}
+
 TEST(MonteCarlo, GCMC) {
   MonteCarlo mc;
   mc.add(MakeConfiguration({{"cubic_side_length", "8"}, {"particle_type0", "../particle/lj.fstprt"}}));
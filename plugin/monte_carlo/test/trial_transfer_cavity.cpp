@@ -0,0 +1,51 @@
+#include <cmath>
+#include "utils/test/utils.h"
+#include "math/include/accumulator.h"
+#include "math/include/random_mt19937.h"
+#include "system/include/model_empty.h"
+#include "system/include/visit_model_cell.h"
+#include "monte_carlo/include/monte_carlo.h"
+#include "monte_carlo/include/metropolis.h"
+#include "monte_carlo/include/trial_translate.h"
+#include "monte_carlo/include/trial_transfer_cavity.h"
+
+namespace feasst {
+
+TEST(TrialTransferCavity, serialize) {
+  auto add = MakeTrialAddCavity({{"cavity_index", "1"}});
+  std::shared_ptr<Trial> add2 = test_serialize<TrialAddCavity, Trial>(*add);
+  auto remove = MakeTrialRemoveCavity();
+  std::shared_ptr<Trial> remove2 =
+    test_serialize<TrialRemoveCavity, Trial>(*remove);
+  TRY(
+    MakeTrialAddCavity({{"num_steps", "2"}});
+    CATCH_PHRASE("requires num_steps=1");
+  );
+}
+
+// The average number of ideal gas particles is exp(beta*mu)*V.
+// Cavity transfers alone cannot reach multiply-occupied cells, so also
+// translate.
+TEST(TrialTransferCavity, ideal_gas) {
+  MonteCarlo mc;
+  mc.set(MakeRandomMT19937({{"seed", "123"}}));
+  mc.add(MakeConfiguration({{"cubic_side_length", "8"},
+    {"particle_type0", "../particle/atom.fstprt"}}));
+  mc.add(MakePotential(MakeModelEmpty(),
+                       MakeVisitModelCell({{"min_length", "1"}})));
+  const double beta_mu = std::log(0.05);
+  mc.set(MakeThermoParams({{"beta", "1"},
+    {"chemical_potential", str(beta_mu)}}));
+  mc.set(MakeMetropolis());
+  mc.add(MakeTrialTranslate({{"tunable_param", "2."}}));
+  mc.add(MakeTrialTransferCavity({{"particle_type", "0"}}));
+  Accumulator num;
+  for (int trial = 0; trial < 200000; ++trial) {
+    mc.attempt(1);
+    num.accumulate(mc.configuration().num_particles());
+  }
+  EXPECT_NEAR(num.average(), 0.05*512, 10*num.block_stdev());
+  mc.system().potential(0).visit_model().check(mc.configuration());
+}
+
+}  // namespace feasst
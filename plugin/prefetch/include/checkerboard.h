@@ -0,0 +1,150 @@
+
+#ifndef FEASST_PREFETCH_CHECKERBOARD_H_
+#define FEASST_PREFETCH_CHECKERBOARD_H_
+
+#include <string>
+#include <vector>
+#include <memory>
+#include "utils/include/arguments.h"
+#include "math/include/alias_table.h"
+#include "monte_carlo/include/monte_carlo.h"
+
+namespace feasst {
+
+class Perturb;
+class Position;
+class TrialSelectParticle;
+
+/**
+  Decompose the domain into a checkerboard of sub-domains and perform local
+  TrialTranslate and TrialRotate in parallel on sub-domains which cannot
+  interact.
+
+  Each cycle proceeds as follows.
+
+  1. The domain is divided into an even number of cells in each dimension,
+     each with a side length no smaller than min_length.
+     The cell grid is shifted by a uniform random amount, and one of the
+     2^dimension colors of the checkerboard is chosen at random.
+     Cells of the same color are separated by at least one cell, and thus
+     particles in different cells of the chosen color do not interact.
+
+  2. Each cell of the chosen color is given to a thread, which attempts
+     trials_per_domain local trials upon the particles whose first site is
+     within that cell.
+     The Trial type is chosen according to the weights of the TrialTranslate
+     and TrialRotate, using their current tunable parameters.
+     Trials which would move the first site out of the cell are rejected.
+
+  3. The particles moved by each thread are synchronized with the other
+     threads, and the current energy of the Criteria is updated by the sum of
+     the energy changes.
+
+  The random shift and color preserve detailed balance, as in the
+  checkerboard scheme of https://doi.org/10.1016/j.jcp.2013.07.023
+
+  There are a number of restrictions.
+  The Criteria must be Metropolis.
+  Only the single-stage TrialTranslate and TrialRotate are used during cycles,
+  and they must select from the same group.
+  Potentials may not include Ewald or an EnergyMap, and min_length must be
+  large enough that the sites of a particle in one cell cannot interact with
+  those in another cell of the same color.
+  Analyze and Modify are updated once per cycle, rather than once per trial,
+  and only on the primary thread.
+  The other threads have copies of the System, which are synchronized at the
+  beginning of each attempt, or copied again if the particles or volume
+  changed.
+  Trial statistics are not updated, so use Tune before activation.
+  If not activated, or with run_until_complete, the simulation is serial.
+ */
+class Checkerboard : public MonteCarlo {
+ public:
+  /**
+    args:
+    - min_length: minimum side length of a cell.
+      If "max_cutoff", use the maximum cutoff of the potentials.
+      Otherwise, provide a number (default: max_cutoff).
+    - trials_per_domain: number of local trials attempted in each cell per
+      cycle. If -1, use the number of particles in the cell (default: -1).
+   */
+  explicit Checkerboard(argtype args = argtype());
+
+  /// Activate checkerboard.
+  void activate_checkerboard(const bool active = true) {
+    is_activated_ = active; }
+
+  /// Return the number of cells in a given dimension.
+  int num_cells(const int dimension) const { return num_cells_[dimension]; }
+
+  /// Return the number of cycles.
+  int64_t num_cycles() const { return num_cycles_; }
+
+  /// Return the number of local trials attempted.
+  int64_t num_attempts() const { return num_attempts_; }
+
+  /// Return the number of accepted local trials.
+  int64_t num_success() const { return num_success_; }
+
+  // public interface for unit testing only
+  // Pick a clone based on ithread.
+  // If ithread == 0, return self. Otherwise, return clones_.
+  MonteCarlo * clone_(const int ithread);
+
+  void serialize(std::ostream& ostr) const override;
+  explicit Checkerboard(std::istream& istr);
+  virtual ~Checkerboard() {}
+
+ protected:
+  void attempt_(int num_trials, TrialFactory * trial_factory,
+                Random * random) override;
+  void run_until_complete_(TrialFactory * trial_factory,
+                           Random * random) override;
+
+ private:
+  bool is_activated_;
+  std::string min_length_;
+  int trials_per_domain_;
+  int64_t num_cycles_ = 0;
+  int64_t num_attempts_ = 0;
+  int64_t num_success_ = 0;
+
+  // temporary
+  int num_threads_;
+  int group_index_;
+  std::vector<MonteCarlo> clones_;
+  std::vector<int> trial_indices_;
+  AliasTable trial_table_;
+  std::vector<std::vector<std::shared_ptr<Perturb> > > perturbs_;
+  std::vector<std::shared_ptr<TrialSelectParticle> > selects_;
+  std::vector<int> num_cells_;
+  std::vector<double> cell_length_;
+  std::vector<double> shift_;
+  std::vector<int> color_;
+  std::vector<int> domain_cell_;
+  std::vector<std::vector<int> > domains_;
+  std::vector<std::vector<bool> > moved_;
+  std::vector<int> domain_thread_;
+  std::vector<Select> synced_;
+  std::vector<double> delta_energy_;
+  std::vector<std::vector<double> > delta_profile_;
+  std::vector<int64_t> thread_attempts_;
+  std::vector<int64_t> thread_success_;
+
+  void create_(Random * random);
+  void copy_clone_(const int thread, Random * random);
+  void update_clones_(Random * random);
+  void build_domains_(Random * random);
+  int cell_(const Position& position, bool * is_active, int * domain) const;
+  void local_trials_(const int thread, const int domain, Random * random);
+  void synchronize_domains_();
+};
+
+inline std::shared_ptr<Checkerboard> MakeCheckerboard(
+    argtype args = argtype()) {
+  return std::make_shared<Checkerboard>(args);
+}
+
+}  // namespace feasst
+
+#endif  // FEASST_PREFETCH_CHECKERBOARD_H_
@@ -2,6 +2,7 @@
 #ifndef FEASST_PREFETCH_PREFETCH_H_
 #define FEASST_PREFETCH_PREFETCH_H_
 
+#include <cstdint>
 #include <string>
 #include <vector>
 #include <memory>
@@ -16,10 +17,10 @@ class Thread;
 // https://cvw.cac.cornell.edu/OpenMP/whileloop
 
 /**
-  Define a pool of threads, each with their own MonteCarlo object and
-  relevant quantities for reversion.
+  Store the result of the trial attempted by one thread, as required by the
+  other threads to reconstruct the serial Markov chain.
 */
-class Pool {
+class PoolResult {
  public:
   void set_index(const int index) {
     DEBUG("index " << index);
@@ -33,6 +34,14 @@ class Pool {
   bool auto_rejected() const { return auto_rejected_; }
   void set_endpoint(const bool endpoint) { endpoint_ = endpoint; }
   bool endpoint() const { return endpoint_; }
+  void set_state_old(const int state_old) { state_old_ = state_old; }
+  int state_old() const { return state_old_; }
+  void set_state_new(const int state_new) { state_new_ = state_new; }
+  int state_new() const { return state_new_; }
+  void set_random_stream(const uint32_t stream) { random_stream_ = stream; }
+  uint32_t random_stream() const { return random_stream_; }
+  void set_random_offset(const uint64_t offset) { random_offset_ = offset; }
+  uint64_t random_offset() const { return random_offset_; }
 
   const std::string str() const {
     std::stringstream ss;
@@ -40,14 +49,36 @@ class Pool {
     return ss.str();
   }
 
-  MonteCarlo mc;
-
  private:
   int index_;
   double ln_prob_;
   bool accepted_;
   bool auto_rejected_ = false;
   bool endpoint_ = true;
+  int state_old_ = 0;
+  int state_new_ = 0;
+  uint32_t random_stream_ = 0;
+  uint64_t random_offset_ = 0;
+};
+
+/**
+  Define a pool of threads, each with their own MonteCarlo object and
+  result slots for the trials of consecutive cycles.
+  The slots alternate between cycles so that a thread may write the result
+  of its next trial while slower threads still read the previous one.
+*/
+class Pool {
+ public:
+  /// Return the result of the cycle with the given parity.
+  const PoolResult& result(const int parity) const { return result_[parity]; }
+
+  /// Return the result of the cycle with the given parity.
+  PoolResult * get_result(const int parity) { return &result_[parity]; }
+
+  MonteCarlo mc;
+
+ private:
+  PoolResult result_[2];
 };
 
 /**
@@ -79,6 +110,26 @@ class Pool {
   In the most complex cases, the data is separated between ones that are
   automatically copied every time, or ones manually choosen based on which
   sites were perturbed.
+
+  Each thread writes the result of its trial into its own slot in the Pool,
+  and the first thread to accept is found with an atomic minimum.
+  Once the first accepted thread is known, each thread updates its own clone
+  independently, so that a cycle without an accepted trial requires a single
+  barrier.
+  Cycles with an accepted trial require one more barrier after the trial is
+  reproduced, and another after synchronization, if enabled.
+  Unless load_balance, each thread selects its trial with its own random
+  number generator.
+
+  The second strategy is also used as a log of the changes made by the
+  accepted trial.
+  When possible, the other threads apply these changes directly (see
+  change_log), which avoids repeating the configurational bias steps and
+  energy calculations of the accepted trial.
+
+  With RandomPhilox, each thread uses its own stream of the same seed, and
+  the accepted trial is reproduced by jumping to the offset of its stream at
+  the beginning of that trial, rather than caching the random numbers.
  */
 class Prefetch : public MonteCarlo {
  public:
@@ -91,6 +142,13 @@ class Prefetch : public MonteCarlo {
       Only use load_balance for equilibration and never for production simulations.
     - synchronize: synchronize data with accepted thread (default: false).
     - ghost: update transition matrix even for trials after acceptance (default: false).
+    - change_log: if true, and the Criteria and all potentials support it,
+      the other threads reproduce an accepted move of particles by applying
+      the changes logged by the accepted thread (the perturbed sites and the
+      synchronized data of the potentials, Trials and Criteria),
+      rather than repeating the trial (default: true).
+      Trials which add or remove particles, or change the volume, are always
+      repeated.
    */
   explicit Prefetch(argtype args = argtype());
 
@@ -124,6 +182,7 @@ class Prefetch : public MonteCarlo {
   int trials_since_check_ = 0;
   bool load_balance_;
   bool ghost_;
+  bool is_change_log_ = false;
 
   // temporary
   int num_threads_;
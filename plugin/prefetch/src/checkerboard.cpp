@@ -0,0 +1,428 @@
+#ifdef _OPENMP
+  #include <omp.h>
+#endif // _OPENMP
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include "utils/include/io.h"
+#include "utils/include/serialize.h"
+#include "math/include/utils_math.h"
+#include "math/include/random.h"
+#include "configuration/include/domain.h"
+#include "system/include/potential.h"
+#include "system/include/visit_model.h"
+#include "system/include/visit_model_inner.h"
+#include "monte_carlo/include/perturb.h"
+#include "monte_carlo/include/trial_select_particle.h"
+#include "prefetch/include/checkerboard.h"
+#include "threads/include/thread_omp.h"
+
+namespace feasst {
+
+Checkerboard::Checkerboard(argtype args) {
+  activate_checkerboard();
+  min_length_ = str("min_length", &args, "max_cutoff");
+  trials_per_domain_ = integer("trials_per_domain", &args, -1);
+  ASSERT(trials_per_domain_ == -1 || trials_per_domain_ > 0,
+    "trials_per_domain: " << trials_per_domain_);
+  FEASST_CHECK_ALL_USED(args);
+}
+
+MonteCarlo * Checkerboard::clone_(const int ithread) {
+  if (ithread == 0) {
+    return this;
+  }
+  return &clones_[ithread];
+}
+
+void Checkerboard::create_(Random * random) {
+  ASSERT(clones_.size() == 0, "clones is of size:" << clones_.size());
+  ASSERT(criteria().class_name() == "Metropolis",
+    "requires Metropolis, not " << criteria().class_name());
+  ASSERT(system().num_configurations() == 1, "requires one Configuration");
+  for (const std::shared_ptr<Potential>& pot :
+       system().potentials().potentials()) {
+    ASSERT(pot->visit_model().class_name() != "Ewald",
+      "Ewald is not implemented");
+    ASSERT(!pot->visit_model().inner().is_energy_map(),
+      "EnergyMap is not implemented");
+  }
+
+  // find the local trials and their relative weights
+  std::vector<double> weights;
+  group_index_ = -1;
+  for (int index = 0; index < trials().num(); ++index) {
+    const Trial& tri = trial(index);
+    if ((tri.class_name() == "TrialTranslate" ||
+         tri.class_name() == "TrialRotate") && tri.num_stages() == 1) {
+      const int group = tri.stage(0).select().group_index();
+      if (group_index_ == -1) {
+        group_index_ = group;
+      }
+      ASSERT(group == group_index_, "Trials must select from the same group");
+      trial_indices_.push_back(index);
+      weights.push_back(tri.weight());
+    }
+  }
+  ASSERT(trial_indices_.size() > 0, "requires TrialTranslate or TrialRotate");
+  trial_table_.set_weights(weights);
+
+  if (ThreadOMP().is_enabled()) {
+    #ifdef _OPENMP
+    #pragma omp parallel
+    {
+    #else
+    {
+    #endif
+      num_threads_ = ThreadOMP().num();
+    }
+  } else {
+    num_threads_ = 1;
+  }
+  clones_.resize(num_threads_);
+  for (int thread = 1; thread < num_threads_; ++thread) {
+    copy_clone_(thread, random);
+  }
+  before_attempts_();
+
+  // each thread has its own copy of the perturbations and selection
+  perturbs_.resize(num_threads_);
+  selects_.resize(num_threads_);
+  for (int thread = 0; thread < num_threads_; ++thread) {
+    for (const int index : trial_indices_) {
+      perturbs_[thread].push_back(deep_copy_derived(
+        const_cast<Perturb*>(&trial(index).stage(0).perturb())));
+    }
+    selects_[thread] = MakeTrialSelectParticle(
+      {{"group_index", str(group_index_)}});
+  }
+  synced_.resize(num_threads_);
+  delta_energy_.resize(num_threads_);
+  delta_profile_.resize(num_threads_);
+  thread_attempts_.resize(num_threads_);
+  thread_success_.resize(num_threads_);
+}
+
+// Copy this to a clone, with a random number generator seeded from random so
+// that the clones are not equal.
+void Checkerboard::copy_clone_(const int thread, Random * random) {
+  std::stringstream clone_ss;
+  MonteCarlo::serialize(clone_ss);
+  clones_[thread] = MonteCarlo(clone_ss);
+  clones_[thread].seed_random(random->uniform(1, 2147483646));
+  clones_[thread].before_attempts_();
+}
+
+// The System may have changed since the last attempt, such as by serial
+// trials or a Modify.
+// If the particles and volume are unchanged, synchronize the positions of
+// the clones, which also updates their cell lists.
+// Otherwise, copy the clones again.
+void Checkerboard::update_clones_(Random * random) {
+  const Configuration& config = configuration();
+  Select all(config.selection_of_all());
+  all.set_trial_state(1);
+  for (int thread = 1; thread < num_threads_; ++thread) {
+    System * sys = clone_(thread)->get_system();
+    const Configuration& clone_config = sys->configuration();
+    bool is_same = std::abs(config.domain().volume() -
+               clone_config.domain().volume()) < NEAR_ZERO &&
+      config.selection_of_all().particle_indices() ==
+      clone_config.selection_of_all().particle_indices();
+    for (int type = 0; is_same && type < config.num_particle_types(); ++type) {
+      is_same = config.num_particles_of_type(type) ==
+                clone_config.num_particles_of_type(type);
+    }
+    if (is_same) {
+      sys->get_configuration()->synchronize_(config, all);
+      sys->finalize(all);
+    } else {
+      copy_clone_(thread, random);
+    }
+  }
+}
+
+int Checkerboard::cell_(const Position& position,
+                        bool * is_active,
+                        int * domain) const {
+  int cell = 0, domain_index = 0;
+  int cell_mult = 1, domain_mult = 1;
+  *is_active = true;
+  for (int dim = 0; dim < static_cast<int>(num_cells_.size()); ++dim) {
+    const double side = num_cells_[dim]*cell_length_[dim];
+    double coord = position.coord(dim) + 0.5*side - shift_[dim];
+    coord -= side*std::floor(coord/side);
+    int index = static_cast<int>(coord/cell_length_[dim]);
+    if (index >= num_cells_[dim]) {
+      index = num_cells_[dim] - 1;
+    }
+    if (index % 2 != color_[dim]) {
+      *is_active = false;
+    }
+    cell += index*cell_mult;
+    cell_mult *= num_cells_[dim];
+    domain_index += (index/2)*domain_mult;
+    domain_mult *= num_cells_[dim]/2;
+  }
+  *domain = domain_index;
+  return cell;
+}
+
+void Checkerboard::build_domains_(Random * random) {
+  const Configuration& config = configuration();
+  const Domain& domain = config.domain();
+  ASSERT(std::abs(domain.xy()) + std::abs(domain.xz()) + std::abs(domain.yz())
+    < NEAR_ZERO, "triclinic domains are not implemented");
+  double min_length;
+  if (min_length_ == "max_cutoff") {
+    min_length = config.model_params().select("cutoff").mixed_max();
+  } else {
+    min_length = str_to_double(min_length_);
+  }
+  const int dimen = domain.dimension();
+  num_cells_.resize(dimen);
+  cell_length_.resize(dimen);
+  shift_.resize(dimen);
+  color_.resize(dimen);
+  int num_domains = 1;
+  for (int dim = 0; dim < dimen; ++dim) {
+    ASSERT(domain.periodic(dim), "requires periodicity in dimension " << dim);
+    const double side = domain.side_length(dim);
+    const int num = 2*static_cast<int>(side/min_length/2.);
+    ASSERT(num >= 2, "side length: " << side << " must be at least twice "
+      << "min_length: " << min_length);
+    num_cells_[dim] = num;
+    cell_length_[dim] = side/static_cast<double>(num);
+    shift_[dim] = cell_length_[dim]*random->uniform();
+    color_[dim] = random->uniform(0, 1);
+    num_domains *= num/2;
+  }
+  domains_.resize(num_domains);
+  for (std::vector<int>& parts : domains_) {
+    parts.clear();
+  }
+  domain_cell_.assign(num_domains, -1);
+  domain_thread_.assign(num_domains, 0);
+  const Select& group = config.group_select(group_index_);
+  bool is_active;
+  int domain_index;
+  for (int index = 0; index < group.num_particles(); ++index) {
+    const Position& position = config.select_particle(
+      group.particle_index(index)).site(group.site_index(index, 0)).position();
+    const int cell = cell_(position, &is_active, &domain_index);
+    if (is_active) {
+      domains_[domain_index].push_back(index);
+      domain_cell_[domain_index] = cell;
+    }
+  }
+  moved_.resize(num_domains);
+  for (int dom = 0; dom < num_domains; ++dom) {
+    moved_[dom].assign(domains_[dom].size(), false);
+  }
+}
+
+void Checkerboard::local_trials_(const int thread,
+                                 const int domain,
+                                 Random * random) {
+  const std::vector<int>& parts = domains_[domain];
+  const int num_parts = static_cast<int>(parts.size());
+  if (num_parts == 0) {
+    return;
+  }
+  domain_thread_[domain] = thread;
+  System * sys = clone_(thread)->get_system();
+  TrialSelectParticle * select = selects_[thread].get();
+  const double beta = sys->thermo_params().beta();
+  int num = trials_per_domain_;
+  if (num == -1) {
+    num = num_parts;
+  }
+  bool is_active;
+  int domain_index;
+  for (int itrial = 0; itrial < num; ++itrial) {
+    const int local = random->uniform(0, num_parts - 1);
+    Perturb * perturb = perturbs_[thread][
+      random->index_from_alias_table(trial_table_)].get();
+    select->select_particle(parts[local], sys->configuration());
+    select->set_mobile_original(sys);
+    perturb->begin_stage(*select);
+    const double en_old = sys->perturbed_energy(select->mobile());
+    const std::vector<double> profile_old = sys->stored_energy_profile();
+    perturb->perturb(sys, select, random);
+    bool accepted = false;
+    double delta = 0.;
+    // reject trials which leave the cell
+    if (cell_(select->mobile().site_positions()[0][0], &is_active,
+              &domain_index) == domain_cell_[domain]) {
+      delta = sys->perturbed_energy(select->mobile()) - en_old;
+      if (delta <= 0. || random->uniform() < std::exp(-beta*delta)) {
+        accepted = true;
+      }
+    }
+    ++thread_attempts_[thread];
+    if (accepted) {
+      sys->finalize(select->mobile());
+      const std::vector<double> profile_new = sys->stored_energy_profile();
+      for (int pot = 0; pot < static_cast<int>(profile_new.size()); ++pot) {
+        delta_profile_[thread][pot] += profile_new[pot] - profile_old[pot];
+      }
+      delta_energy_[thread] += delta;
+      moved_[domain][local] = true;
+      ++thread_success_[thread];
+    } else {
+      perturb->revert(sys);
+      sys->revert(select->mobile());
+    }
+  }
+}
+
+void Checkerboard::synchronize_domains_() {
+  const Select& group = configuration().group_select(group_index_);
+  for (Select& synced : synced_) {
+    synced.clear();
+  }
+  for (int dom = 0; dom < static_cast<int>(domains_.size()); ++dom) {
+    for (int local = 0; local < static_cast<int>(moved_[dom].size()); ++local) {
+      if (moved_[dom][local]) {
+        const int index = domains_[dom][local];
+        synced_[domain_thread_[dom]].add_particle(group.particle_index(index),
+                                                  group.site_indices(index));
+      }
+    }
+  }
+
+  // update the primary thread with the moves of the other threads
+  for (int thread = 1; thread < num_threads_; ++thread) {
+    if (synced_[thread].num_particles() > 0) {
+      get_system()->get_configuration()->synchronize_(
+        clone_(thread)->configuration(), synced_[thread]);
+      get_system()->finalize(synced_[thread]);
+    }
+  }
+
+  // update the other threads with the moves of all other threads
+  #ifdef _OPENMP
+  #pragma omp parallel for num_threads(num_threads_)
+  #endif // _OPENMP
+  for (int thread = 1; thread < num_threads_; ++thread) {
+    System * sys = clone_(thread)->get_system();
+    for (int other = 0; other < num_threads_; ++other) {
+      if (other != thread && synced_[other].num_particles() > 0) {
+        sys->get_configuration()->synchronize_(configuration(),
+                                               synced_[other]);
+        sys->finalize(synced_[other]);
+      }
+    }
+  }
+
+  // update the current energy
+  double energy = criteria().current_energy();
+  std::vector<double> profile = criteria().current_energy_profile();
+  for (int thread = 0; thread < num_threads_; ++thread) {
+    energy += delta_energy_[thread];
+    for (int pot = 0; pot < static_cast<int>(profile.size()); ++pot) {
+      profile[pot] += delta_profile_[thread][pot];
+    }
+  }
+  get_criteria()->set_current_energy(energy);
+  get_criteria()->set_current_energy_profile(profile);
+}
+
+void Checkerboard::run_until_complete_(TrialFactory * trial_factory,
+                                       Random * random) {
+  if (is_activated_) {
+    WARN("Checkerboard is serial when running until complete.");
+  }
+  MonteCarlo::run_until_complete_(trial_factory, random);
+}
+
+void Checkerboard::attempt_(
+    int num_trials,
+    TrialFactory * trial_factory,
+    Random * random) {
+  if (!is_activated_) {
+    MonteCarlo::attempt_(num_trials, trial_factory, random);
+    return;
+  }
+  if (clones_.size() == 0) {
+    create_(random);
+  } else {
+    update_clones_(random);
+  }
+
+  // use the current tunable parameters of the trials
+  for (int thread = 0; thread < num_threads_; ++thread) {
+    for (int itr = 0; itr < static_cast<int>(trial_indices_.size()); ++itr) {
+      perturbs_[thread][itr]->set_tunable(
+        trial(trial_indices_[itr]).stage(0).perturb().tunable().value());
+    }
+  }
+
+  const int num_pots = static_cast<int>(
+    criteria().current_energy_profile().size());
+  int itrial = 0;
+  while (itrial < num_trials) {
+    build_domains_(random);
+    const int num_domains = static_cast<int>(domains_.size());
+    for (int thread = 0; thread < num_threads_; ++thread) {
+      delta_energy_[thread] = 0.;
+      delta_profile_[thread].assign(num_pots, 0.);
+      thread_attempts_[thread] = 0;
+      thread_success_[thread] = 0;
+    }
+    #ifdef _OPENMP
+    #pragma omp parallel num_threads(num_threads_)
+    {
+      const int thread = omp_get_thread_num();
+    #else // _OPENMP
+    {
+      const int thread = 0;
+    #endif // _OPENMP
+      Random * thread_random = random;
+      if (thread != 0) {
+        thread_random = clone_(thread)->get_random();
+      }
+      #ifdef _OPENMP
+      #pragma omp for schedule(dynamic)
+      #endif // _OPENMP
+      for (int dom = 0; dom < num_domains; ++dom) {
+        local_trials_(thread, dom, thread_random);
+      }
+    }
+    synchronize_domains_();
+    int64_t num_cycle_attempts = 0;
+    for (int thread = 0; thread < num_threads_; ++thread) {
+      num_cycle_attempts += thread_attempts_[thread];
+      num_success_ += thread_success_[thread];
+    }
+    num_attempts_ += num_cycle_attempts;
+    ++num_cycles_;
+    itrial += std::max(static_cast<int64_t>(1), num_cycle_attempts);
+    after_trial_analyze_();
+    after_trial_modify_();
+  }
+}
+
+void Checkerboard::serialize(std::ostream& ostr) const {
+  MonteCarlo::serialize(ostr);
+  feasst_serialize_version(3058, ostr);
+  feasst_serialize(is_activated_, ostr);
+  feasst_serialize(min_length_, ostr);
+  feasst_serialize(trials_per_domain_, ostr);
+  feasst_serialize(num_cycles_, ostr);
+  feasst_serialize(num_attempts_, ostr);
+  feasst_serialize(num_success_, ostr);
+}
+
+Checkerboard::Checkerboard(std::istream& istr) : MonteCarlo(istr) {
+  const int version = feasst_deserialize_version(istr);
+  ASSERT(version == 3058, "version: " << version);
+  feasst_deserialize(&is_activated_, istr);
+  feasst_deserialize(&min_length_, istr);
+  feasst_deserialize(&trials_per_domain_, istr);
+  feasst_deserialize(&num_cycles_, istr);
+  feasst_deserialize(&num_attempts_, istr);
+  feasst_deserialize(&num_success_, istr);
+}
+
+}  // namespace feasst
@@ -1,10 +1,14 @@
 #ifdef _OPENMP
   #include <omp.h>
 #endif // _OPENMP
+#include <algorithm>
+#include <atomic>
 #include <cmath>
 #include <limits>
 #include <random>
 #include "utils/include/serialize.h"
+#include "math/include/random_philox.h"
+#include "configuration/include/domain.h"
 #include "prefetch/include/prefetch.h"
 #include "threads/include/thread_omp.h"
 
@@ -19,6 +23,7 @@ Prefetch::Prefetch(argtype args) {
   load_balance_ = boolean("load_balance", &args, false);
   ghost_ = boolean("ghost", &args, false);
   is_synchronize_ = boolean("synchronize", &args, false);
+  is_change_log_ = boolean("change_log", &args, true);
   #ifdef DEBUG_SERIAL_MODE_5324634
     WARN("DEBUG_SERIAL_MODE_5324634");
   #endif
@@ -67,8 +72,18 @@ void Prefetch::create(std::vector<Pool> * pool) {
   }
 
   // seed random number generators so that clones are not equal
-  for (int i = 0; i < num_threads_ - 1; ++i) {
-    clone_(i)->seed_random(rand());
+  const RandomPhilox * philox = dynamic_cast<const RandomPhilox*>(&random());
+  if (philox) {
+    // counter-based generators use a different stream for each thread
+    for (int thread = 1; thread < num_threads_; ++thread) {
+      RandomPhilox * clone_philox =
+        dynamic_cast<RandomPhilox*>(clone_(thread)->get_random());
+      clone_philox->set_stream(philox->stream() + thread);
+    }
+  } else {
+    for (int i = 0; i < num_threads_ - 1; ++i) {
+      clone_(i)->seed_random(rand());
+    }
   }
 
   // run some checks before attempting trials
@@ -117,71 +132,68 @@ void Prefetch::attempt_(
     create(&pool_);
   }
 
-  int itrial = 0;
-  int first_thread_accepted;
+  // The index of the first thread to accept in each cycle.
+  // Three are rotated so that the next may be reset before the barrier.
+  std::atomic<int> first_accepted[3];
+  for (int cycle = 0; cycle < 3; ++cycle) {
+    first_accepted[cycle] = num_threads_;
+  }
+  int load_balance_index = -1;
+  const bool is_change_log = is_change_log_ &&
+    system().is_synchronize_complete() &&
+    criteria().is_synchronize_complete();
+  const int trials_since_check_begin = trials_since_check_;
+  bool is_complete = false;
   int proc_id = 0;
   #ifdef _OPENMP
   #pragma omp parallel private(proc_id)
   {
     proc_id = omp_get_thread_num();
   #endif // _OPENMP
+    Pool * pool = &pool_[proc_id];
+    MonteCarlo * mc = clone_(proc_id);
+    RandomPhilox * philox = dynamic_cast<RandomPhilox*>(mc->get_random());
+    int itrial = 0;
+    int trials_since_check = trials_since_check_begin;
+    int cycle = 0;
 
     // num_trials may change to terminate loop
     bool complete = false;
     while (!complete) {
-      #ifndef _OPENMP
-      for (proc_id = 0; proc_id < num_threads_; ++proc_id) {
-      #endif // _OPENMP
-
-      double previous_energy = criteria().current_energy();
-      DEBUG("previous_energy " << previous_energy);
-
-      #ifdef DEBUG_SERIAL_MODE_5324634
-      #pragma omp critical
-      {
-      #endif
-
+      const int parity = cycle % 2;
+      std::atomic<int> * first = &first_accepted[cycle % 3];
+      PoolResult * result = pool->get_result(parity);
       if (proc_id == 0) {
         DEBUG("************************");
         DEBUG("* Begin Prefetch cycle *");
         DEBUG("************************");
-        DEBUG("N " << clone_(proc_id)->configuration().num_particles());
+        DEBUG("N " << mc->configuration().num_particles());
+        first_accepted[(cycle + 1) % 3] = num_threads_;
       }
 
-      // ordered list of index of trial to perform on each thread.
-      if (proc_id == 0) {
-        if (load_balance_) {
-          // perform the same type of trial on each thread.
-          const int index = trial_factory->random_index(random);
-          for (int ithread = 0; ithread < num_threads_; ++ithread) {
-            pool_[ithread].set_index(index);
-          }
-        } else {
-          // randomly generator the type of trial for each thread.
-          for (int ithread = 0; ithread < num_threads_; ++ithread) {
-            pool_[ithread].set_index(trial_factory->random_index(random));
-          }
+      // select the index of the trial to perform on each thread.
+      if (load_balance_) {
+        // perform the same type of trial on each thread.
+        if (proc_id == 0) {
+          load_balance_index = trial_factory->random_index(random);
         }
-//        for (int ithread = 0; ithread < num_threads_; ++ithread) {
-//          DEBUG("num attempts " << pool_[ithread].mc.trials().num_attempts() << " "
-//                                << pool_[ithread].mc.trials().num_success() << " " << &pool_[ithread].mc);
-//        }
-//        DEBUG("num attempts main " << trials().num_attempts() << " "
-//                                     << trials().num_success() << " " << this);
-      }
-
-      #ifdef DEBUG_SERIAL_MODE_5324634
+        #ifdef _OPENMP
+        #pragma omp barrier
+        #endif // _OPENMP
+        result->set_index(load_balance_index);
+      } else {
+        result->set_index(
+          mc->get_trial_factory()->random_index(mc->get_random()));
       }
-      #endif
-
-      #ifdef _OPENMP
-      #pragma omp barrier
-      #endif // _OPENMP
 
       // set random number generators to store (zero storage for selecting trial?).
-      Pool * pool = &pool_[proc_id];
-      MonteCarlo * mc = clone_(proc_id);
       mc->load_cache_(true);
+      if (philox) {
+        // counter-based generators reproduce trials without the cache
+        mc->get_random()->set_cache_to_load(false);
+        result->set_random_stream(philox->stream());
+        result->set_random_offset(philox->offset());
+      }
 
       #ifdef DEBUG_SERIAL_MODE_5324634
       #pragma omp critical
@@ -191,13 +203,20 @@ void Prefetch::attempt_(
       // Each processor attempts their trial in parallel,
       // without analyze modify or checkpoint.
       // Store new macrostate and acceptance prob
-      pool->set_accepted(mc->attempt_trial(pool->index()));
-      pool->set_auto_rejected(mc->trial(pool->index()).accept().reject());
-      pool->set_endpoint(mc->trial(pool->index()).accept().endpoint());
-      pool->set_ln_prob(mc->trial(pool->index()).accept().ln_metropolis_prob());
-      DEBUG("proc id " << proc_id << " ln prob " << pool->ln_prob());
-      DEBUG("critical proc_id " << proc_id << " " << pool->str());
-      DEBUG("nump " << mc->system().configuration().num_particles());
+      result->set_accepted(mc->attempt_trial(result->index()));
+      const Trial& attempted = mc->trial(result->index());
+      result->set_auto_rejected(attempted.accept().reject());
+      result->set_endpoint(attempted.accept().endpoint());
+      result->set_ln_prob(attempted.accept().ln_metropolis_prob());
+      result->set_state_old(mc->criteria().state_old());
+      result->set_state_new(mc->criteria().state_new());
+      DEBUG("proc id " << proc_id << " ln prob " << result->ln_prob());
+      DEBUG("proc_id " << proc_id << " " << result->str());
+      if (result->accepted()) {
+        int current = first->load();
+        while (proc_id < current &&
+               !first->compare_exchange_weak(current, proc_id)) {}
+      }
 
       #ifdef DEBUG_SERIAL_MODE_5324634
       }
@@ -207,291 +226,200 @@ void Prefetch::attempt_(
       #pragma omp barrier
       #endif // _OPENMP
 
-      // Determine first trial accepted (if any).
-      if (proc_id == 0) {
-        first_thread_accepted = num_threads_;
-        for (int ithread = 0; ithread < num_threads_; ++ithread) {
-          if (pool_[ithread].accepted() &&
-              first_thread_accepted == num_threads_) {
-            first_thread_accepted = ithread;
-            DEBUG(MAX_PRECISION << ithread << " accepted, en: " << clone_(ithread)->criteria().current_energy());
-          }
-        }
-        DEBUG("first thread " << first_thread_accepted);
-      }
-
-      #ifdef _OPENMP
-      #pragma omp barrier
-      #endif // _OPENMP
+      const int first_thread_accepted = first->load();
+      DEBUG("first thread " << first_thread_accepted);
 
       // any trial after accepted may contribute as a ghost
-      if (proc_id == 0 && ghost_) {
-        DEBUG("Update criteria with ghost trials (for TM) for each thread after first accepted");
+      if (ghost_) {
         for (int ithread = first_thread_accepted + 1;
              ithread < num_threads_;
              ++ithread) {
-          const Criteria& old_criteria = clone_(ithread)->criteria();
-          for (int jthread = 0; jthread < num_threads_; ++jthread) {
-            DEBUG("ghost " << ithread << " " << jthread);
-            DEBUG("first accepted " << first_thread_accepted);
-            clone_(jthread)->ghost_trial_(
-              pool_[ithread].ln_prob(),
-              old_criteria.state_old(),
-              old_criteria.state_new(),
-              pool_[ithread].endpoint());
-          }
+          const PoolResult& ghost = pool_[ithread].result(parity);
+          mc->ghost_trial_(ghost.ln_prob(), ghost.state_old(),
+                           ghost.state_new(), ghost.endpoint());
         }
       }
 
-      #ifdef _OPENMP
-      #pragma omp barrier
-      #endif // _OPENMP
-
-      #ifdef DEBUG_SERIAL_MODE_5324634
-      #pragma omp critical
-      {
-      #endif
-
       // revert trials after accepted trial.
       if (first_thread_accepted != num_threads_) {
         if (proc_id > first_thread_accepted) {
           DEBUG("reverting trial " << proc_id);
-          mc->revert_(pool->index(), pool->accepted(), pool->endpoint(),
-                      pool->auto_rejected(), pool->ln_prob());
+          mc->revert_(result->index(), result->accepted(), result->endpoint(),
+                      result->auto_rejected(), result->ln_prob());
         }
       }
 
-      #ifdef DEBUG_SERIAL_MODE_5324634
-      }
-      #endif
-
-      #ifdef _OPENMP
-      #pragma omp barrier
-      #endif // _OPENMP
-
-      // testing decouple here HWH
-      if (proc_id == 0) {
-        DEBUG("for each thread up to the first accepted, "
-           << "update other threads (incl. main) regarding failed attempt by "
-           << "thread. update steppers");
-        for (int ithread = 0; ithread < first_thread_accepted; ++ithread) {
-          DEBUG("imitate failed " << ithread);
-          // loop through other threads to update
-          const Criteria& old_criteria = clone_(ithread)->criteria();
-          DEBUG("nump " << clone_(ithread)->configuration().num_particles());
-          for (int jthread = 0; jthread < num_threads_; ++jthread) {
-            if (ithread != jthread) {
-              DEBUG("j " << jthread <<
-                   " index " << pool_[ithread].index() <<
-                   " lnp " << pool_[ithread].ln_prob() <<
-                   " old " << old_criteria.state_old() <<
-                   " new " << old_criteria.state_new());
-              clone_(jthread)->imitate_trial_rejection_(
-                pool_[ithread].index(),
-                pool_[ithread].ln_prob(),
-                pool_[ithread].endpoint(),
-                pool_[ithread].auto_rejected(),
-                old_criteria.state_old(),
-                old_criteria.state_new()
-              );
-            } else {
-              // Update TM on rejection
-              clone_(jthread)->get_criteria()->imitate_trial_rejection_(
-                pool_[ithread].ln_prob(),
-                old_criteria.state_old(),
-                old_criteria.state_new(),
-                pool_[ithread].endpoint()
-              );
-            }
-            if (jthread == 0) {
-              after_trial_analyze_();
-            }
-          }
-          DEBUG("num attempts " << pool->mc.trials().num_attempts() << " "
-                                << pool->mc.trials().num_success() << " " << &pool->mc);
+      // for each thread up to the first accepted, update this thread
+      // regarding the failed attempt.
+      for (int ithread = 0; ithread < first_thread_accepted; ++ithread) {
+        const PoolResult& failed = pool_[ithread].result(parity);
+        if (ithread != proc_id) {
+          mc->imitate_trial_rejection_(failed.index(), failed.ln_prob(),
+            failed.endpoint(), failed.auto_rejected(), failed.state_old(),
+            failed.state_new());
+        } else {
+          // Update TM on rejection
+          mc->get_criteria()->imitate_trial_rejection_(failed.ln_prob(),
+            failed.state_old(), failed.state_new(), failed.endpoint());
+        }
+        if (proc_id == 0) {
+          after_trial_analyze_();
         }
-        DEBUG("num attempts main " << trials().num_attempts() << " "
-                                     << trials().num_success() << " " << this);
       }
 
-      #ifdef _OPENMP
-      #pragma omp barrier
-      #endif // _OPENMP
-
-      #ifdef DEBUG_SERIAL_MODE_5324634
-      #pragma omp critical
-      {
-      #endif
-
       if (first_thread_accepted < num_threads_) {
         DEBUG("Replicate first accepted trial in all other threads in proc_id " << proc_id);
-        Pool * accepted_pool = &pool_[first_thread_accepted];
-        if (proc_id != first_thread_accepted) {
-          // load/unload system energies and random numbers
-          mc->unload_cache_(*clone_(first_thread_accepted));
-          mc->attempt_trial(accepted_pool->index());
+        const int accepted_index =
+          pool_[first_thread_accepted].result(parity).index();
+        const MonteCarlo& cln = *clone_(first_thread_accepted);
+        const Select& perturbed = cln.trial(accepted_index).accept().perturbed();
+        const bool apply_log = is_change_log &&
+          perturbed.trial_state() == 1 &&
+          std::abs(cln.configuration().domain().volume() -
+                   mc->configuration().domain().volume()) < NEAR_ZERO;
+        if (apply_log) {
+          // apply the changes after the accepted clone is finalized
+          if (proc_id == first_thread_accepted) {
+            mc->finalize_(accepted_index);
+          }
+          #ifdef _OPENMP
+          #pragma omp barrier
+          #endif // _OPENMP
+          if (proc_id != first_thread_accepted) {
+            mc->synchronize_(cln, perturbed);
+            mc->get_system()->finalize(perturbed);
+          }
+        } else {
+          if (proc_id != first_thread_accepted) {
+            if (philox) {
+              // jump to the stream and offset of the accepted trial
+              const PoolResult& accepted =
+                pool_[first_thread_accepted].result(parity);
+              const uint32_t stream = philox->stream();
+              const uint64_t offset = philox->offset();
+              philox->set_stream(accepted.random_stream());
+              philox->set_offset(accepted.random_offset());
+              mc->get_system()->unload_cache(cln.system());
+              mc->attempt_trial(accepted_index);
+              philox->set_stream(stream);
+              philox->set_offset(offset);
+            } else {
+              // load/unload system energies and random numbers
+              mc->unload_cache_(cln);
+              mc->attempt_trial(accepted_index);
+            }
+          }
+          mc->finalize_(accepted_index);
         }
-        mc->finalize_(accepted_pool->index());
-      } else {
-        DEBUG("all rejected, en: " << criteria().current_energy());
-      }
 
-      #ifdef DEBUG_SERIAL_MODE_5324634
-      }
-      #endif
+        // the accepted clone may not change until others are done with it
+        #ifdef _OPENMP
+        #pragma omp barrier
+        #endif // _OPENMP
 
-      #ifdef _OPENMP
-      #pragma omp barrier
-      #endif // _OPENMP
-
-      #ifdef DEBUG_SERIAL_MODE_5324634
-      #pragma omp critical
-      {
-      #endif
-
-      if (first_thread_accepted < num_threads_) {
-        if (is_synchronize_) {
+        if (is_synchronize_ && !apply_log) {
           DEBUG("synchronize other threads with first accepted thread " << proc_id);
-          Pool * accepted_pool = &pool_[first_thread_accepted];
           if (proc_id != first_thread_accepted) {
-            DEBUG(proc_id);
-            DEBUG(first_thread_accepted);
-            DEBUG(accepted_pool->index());
-            const MonteCarlo& cln = *clone_(first_thread_accepted);
-            DEBUG(cln.trial(accepted_pool->index()).accept().perturbed().str());
-            mc->synchronize_(cln,
-              cln.trial(accepted_pool->index()).accept().perturbed());
+            DEBUG(perturbed.str());
+            mc->synchronize_(cln, perturbed);
           }
+          #ifdef _OPENMP
+          #pragma omp barrier
+          #endif // _OPENMP
         }
         if (proc_id == 0) {
           after_trial_analyze_();
         }
+      } else {
+        DEBUG("all rejected, en: " << mc->criteria().current_energy());
       }
 
-      #ifdef DEBUG_SERIAL_MODE_5324634
-      }
-      #endif
-
-      #ifdef _OPENMP
-      #pragma omp barrier
-      #endif // _OPENMP
-
-      #ifdef DEBUG_SERIAL_MODE_5324634
-      #pragma omp critical
-      {
-      #endif
-
       // disable cache
       mc->load_cache_(false);
 
       // perform after trial on all clones/main after multiple trials performed
-      // do this in serial so that files are not written to by multiple threads
-      // simultaneously
-      #ifdef DEBUG_SERIAL_MODE_5324634
-      #pragma omp critical
-      {
-      #else
-      {
-      #endif
-      for (int im = 0;
-           im < std::min(num_threads_, first_thread_accepted + 1);
-           ++im) {
-        // DEBUG("im " << im << " first " << first_thread_accepted);
+      const int increment = std::min(num_threads_, first_thread_accepted + 1);
+      for (int im = 0; im < increment; ++im) {
         mc->after_trial_modify_();
       }
-      }
-
-      DEBUG("update itrial");
-      //if (proc_id <= first_thread_accepted) {
-      //  ++itrial;
-      //  ++trials_since_check_;
-      if (proc_id == 0) {
-        int increment = num_threads_;
-        if (first_thread_accepted < num_threads_) {
-          increment = first_thread_accepted + 1;
-        }
-        itrial += increment;
-        trials_since_check_ += increment;
-      }
-
-      #ifdef DEBUG_SERIAL_MODE_5324634
-      }
-      #endif
-
-      #ifdef _OPENMP
-      #pragma omp barrier
-      #endif // _OPENMP
-
-      #ifdef DEBUG_SERIAL_MODE_5324634
-      #pragma omp critical
-      {
-      #endif
+      itrial += increment;
+      trials_since_check += increment;
 
       DEBUG("periodically check that all threads are equal");
-      if (trials_since_check_ >= trials_per_check_ && proc_id > 0) {
-        trials_since_check_ = 0;
-        const double energy = criteria().current_energy();
-        DEBUG("check that the current energy of all threads and main are the same: " << energy);
-        const double tolerance = 1e-8;
-        const MonteCarlo& mcc = *clone_(proc_id);
-        const double diff = mcc.criteria().current_energy() - energy;
-        ASSERT(std::abs(diff) <= tolerance, "diff: " << diff);
-        ASSERT(system().configuration().is_equal(mcc.system().configuration(), tolerance), "configs not equal thread" << proc_id);
-        ASSERT(trials().is_equal(mcc.trials()), "trials not equal thread" << proc_id);
-        ASSERT(criteria().is_equal(mcc.criteria(), tolerance), "criteria not equal: " << proc_id);
-
-        // periodically equate all clones to first thread to prevent drift
-//        std::stringstream clone_ss;
-//        MonteCarlo::serialize(clone_ss);
-//        pool_[proc_id].mc = MonteCarlo(clone_ss);
-//        clone_(proc_id)->seed_random(rand());  // HWH not thread safe // HWH consider setting RNG to previous seeds manually
+      if (trials_since_check >= trials_per_check_) {
+        trials_since_check = 0;
+        #ifdef _OPENMP
+        #pragma omp barrier
+        #endif // _OPENMP
+        if (proc_id > 0) {
+          const double energy = criteria().current_energy();
+          DEBUG("check that the current energy of all threads and main are the same: " << energy);
+          const double tolerance = 1e-8;
+          const double diff = mc->criteria().current_energy() - energy;
+          ASSERT(std::abs(diff) <= tolerance, "diff: " << diff);
+          ASSERT(system().configuration().is_equal(mc->system().configuration(), tolerance), "configs not equal thread" << proc_id);
+          ASSERT(trials().is_equal(mc->trials()), "trials not equal thread" << proc_id);
+          ASSERT(criteria().is_equal(mc->criteria(), tolerance), "criteria not equal: " << proc_id);
+        }
+        #ifdef _OPENMP
+        #pragma omp barrier
+        #endif // _OPENMP
       }
 
-      #ifdef DEBUG_SERIAL_MODE_5324634
+      // The first thread decides completion for all threads.
+      DEBUG("itrial: " << itrial);
+      if (proc_id == 0) {
+        if (check_criteria_for_completion) {
+          if (mc->criteria().is_complete()) {
+            is_complete = true;
+          }
+        } else {
+          if (itrial >= num_trials) {
+            is_complete = true;
+          }
+        }
       }
-      #endif
-
       #ifdef _OPENMP
       #pragma omp barrier
       #endif // _OPENMP
-
-      DEBUG("itrial: " << itrial);
-      if (check_criteria_for_completion) {
-        if (criteria().is_complete()) {
-          complete = true;
-        }
-      } else {
-        if (itrial >= num_trials) {
-          complete = true;
-        }
-      }
+      complete = is_complete;
       #ifdef _OPENMP
       #pragma omp barrier
       #endif // _OPENMP
+      ++cycle;
     }
+    if (proc_id == 0) {
+      trials_since_check_ = trials_since_check;
+    }
+  #ifdef _OPENMP
   }
+  #endif // _OPENMP
 }
 
 void Prefetch::serialize(std::ostream& ostr) const {
   MonteCarlo::serialize(ostr);
-  feasst_serialize_version(5686, ostr);
+  feasst_serialize_version(5687, ostr);
   feasst_serialize(is_activated_, ostr);
   feasst_serialize(trials_per_check_, ostr);
   feasst_serialize(trials_since_check_, ostr);
   feasst_serialize(load_balance_, ostr);
   feasst_serialize(is_synchronize_, ostr);
   feasst_serialize(ghost_, ostr);
+  feasst_serialize(is_change_log_, ostr);
 }
 
 Prefetch::Prefetch(std::istream& istr) : MonteCarlo(istr) {
   const int version = feasst_deserialize_version(istr);
-  ASSERT(version == 5686, "version: " << version);
+  ASSERT(version >= 5686 && version <= 5687, "version: " << version);
   feasst_deserialize(&is_activated_, istr);
   feasst_deserialize(&trials_per_check_, istr);
   feasst_deserialize(&trials_since_check_, istr);
   feasst_deserialize(&load_balance_, istr);
   feasst_deserialize(&is_synchronize_, istr);
   feasst_deserialize(&ghost_, istr);
+  if (version >= 5687) {
+    feasst_deserialize(&is_change_log_, istr);
+  }
 }
 
 }  // namespace feasst
@@ -0,0 +1,78 @@
+#include "utils/test/utils.h"
+#include "math/include/random_mt19937.h"
+#include "system/include/lennard_jones.h"
+#include "system/include/long_range_corrections.h"
+#include "system/include/visit_model_cell.h"
+#include "monte_carlo/include/run.h"
+#include "monte_carlo/include/metropolis.h"
+#include "monte_carlo/include/trial_translate.h"
+#include "monte_carlo/include/trial_add.h"
+#include "prefetch/include/checkerboard.h"
+#include "steppers/include/check_energy.h"
+#include "steppers/include/tune.h"
+
+namespace feasst {
+
+void run_checkerboard(const int trials, const bool cell) {
+  auto mc = MakeCheckerboard();
+  mc->set(MakeRandomMT19937({{"seed", "123"}}));
+  mc->add(MakeConfiguration({{"cubic_side_length", "12"},
+                             {"particle_type0", "../particle/lj.fstprt"}}));
+  if (cell) {
+    mc->add(MakePotential(MakeLennardJones(),
+                          MakeVisitModelCell({{"min_length", "3"}})));
+  } else {
+    mc->add(MakePotential(MakeLennardJones()));
+  }
+  mc->add(MakePotential(MakeLongRangeCorrections()));
+  mc->set(MakeThermoParams({{"beta", "1.2"}, {"chemical_potential", "1."}}));
+  mc->set(MakeMetropolis());
+  mc->add(MakeTrialTranslate({{"weight", "1."}, {"tunable_param", "1."}}));
+  mc->add(MakeCheckEnergy({{"trials_per_update", "1"}, {"tolerance", "1e-8"}}));
+  mc->add(MakeTune());
+  mc->activate_checkerboard(false);
+  mc->add(MakeTrialAdd({{"particle_type", "0"}}));
+  mc->run(MakeRun({{"until_num_particles", "100"}}));
+  mc->run(MakeRemoveTrial({{"name", "TrialAdd"}}));
+  mc->attempt(1e3);
+  mc->run(MakeRemoveModify({{"name", "Tune"}}));
+  // activate checkerboard after initial configuration and tuning
+  mc->activate_checkerboard(true);
+  mc->attempt(trials);
+  EXPECT_EQ(4, mc->num_cells(0));
+  EXPECT_GT(mc->num_cycles(), 0);
+  EXPECT_GE(mc->num_attempts(), trials);
+  EXPECT_GT(mc->num_success(), 0);
+  EXPECT_EQ(100, mc->configuration().num_particles());
+  Checkerboard mc2 = test_serialize(*mc);
+  EXPECT_EQ(mc->num_attempts(), mc2.num_attempts());
+
+  // serial trials move particles in the primary thread only
+  mc->activate_checkerboard(false);
+  mc->attempt(1e3);
+  mc->activate_checkerboard(true);
+  mc->attempt(trials);
+
+  // serial trials add particles in the primary thread only
+  mc->activate_checkerboard(false);
+  mc->add(MakeTrialAdd({{"particle_type", "0"}}));
+  mc->run(MakeRun({{"until_num_particles", "110"}}));
+  mc->run(MakeRemoveTrial({{"name", "TrialAdd"}}));
+  mc->activate_checkerboard(true);
+  mc->attempt(trials);
+  EXPECT_EQ(110, mc->configuration().num_particles());
+}
+
+TEST(Checkerboard, lj) {
+  run_checkerboard(1e3, false);
+}
+
+TEST(Checkerboard, lj_cell) {
+  run_checkerboard(1e3, true);
+}
+
+TEST(Checkerboard, lj_LONG) {
+  run_checkerboard(1e6, true);
+}
+
+}  // namespace feasst
@@ -1,9 +1,11 @@
 #include "utils/test/utils.h"
 #include "threads/include/thread_omp.h"
 #include "math/include/random_mt19937.h"
+#include "math/include/random_philox.h"
 #include "configuration/include/domain.h"
 #include "system/include/lennard_jones.h"
 #include "system/include/long_range_corrections.h"
+#include "system/include/visit_model_cell.h"
 #include "monte_carlo/include/run.h"
 #include "monte_carlo/include/metropolis.h"
 #include "monte_carlo/include/trial_transfer.h"
@@ -34,13 +36,20 @@
 
 namespace feasst {
 
-void run_prefetch(const int trials, const int trials_per) {
-  auto mc = MakePrefetch();
+void run_prefetch(const int trials, const int trials_per,
+    const bool change_log = true, const bool cell = false) {
+  auto mc = MakePrefetch({{"change_log", str(change_log)}});
 //  mc->set(MakeRandomMT19937({{"seed", "1592943710"}}));
   mc->set(MakeRandomMT19937({{"seed", "1596650884"}}));
-  mc->add(MakeConfiguration({{"cubic_side_length", "8"},
+  // cell lists require more than three cells per side
+  mc->add(MakeConfiguration({{"cubic_side_length", cell ? "12" : "8"},
                              {"particle_type0", "../particle/lj.fstprt"}}));
-  mc->add(MakePotential(MakeLennardJones()));
+  if (cell) {
+    mc->add(MakePotential(MakeLennardJones(),
+      MakeVisitModelCell({{"min_length", "3"}})));
+  } else {
+    mc->add(MakePotential(MakeLennardJones()));
+  }
   mc->add(MakePotential(MakeLongRangeCorrections()));
   mc->set(MakeThermoParams({{"beta", "1.2"}, {"chemical_potential", "1."}}));
   mc->set(MakeMetropolis());
@@ -50,11 +59,14 @@ void run_prefetch(const int trials, const int trials_per) {
   mc->add(MakeTune());
   mc->activate_prefetch(false);
   mc->add(MakeTrialAdd({{"particle_type", "0"}}));
-  mc->run(MakeRun({{"until_num_particles", "50"}}));
+  mc->run(MakeRun({{"until_num_particles", cell ? "170" : "50"}}));
   mc->run(MakeRemoveTrial({{"name", "TrialAdd"}}));
   // activate prefetch after initial configuration
   mc->activate_prefetch(true);
   mc->attempt(trials);
+  mc->system().check();
+  EXPECT_NEAR(mc->criteria().current_energy(),
+              mc->get_system()->unoptimized_energy(0), 1e-8);
 //  EXPECT_EQ(mc->analyze(0).trials_since_write(),
 //            mc->modify(0).trials_since_update());
 }
@@ -63,13 +75,25 @@ TEST(Prefetch, NVT_benchmark) {
   run_prefetch(1e3, 1e1);
 }
 
+TEST(Prefetch, NVT_replay) {
+  run_prefetch(1e3, 1e1, false);
+}
+
+TEST(Prefetch, NVT_cell) {
+  run_prefetch(1e4, 1e2, true, true);
+}
+
 TEST(Prefetch, NVT_benchmark_LONG) {
   run_prefetch(1e6, 1e3); // 5.4s on 4 cores of i7-4770K @ 3.5GHz
 }
 
-void prefetch(System system, const int sync = 0) {
+void prefetch(System system, const int sync = 0, const bool philox = false) {
   auto mc = MakePrefetch({{"trials_per_check", "1"}, {"synchronize", str(sync)}});
-  mc->set(MakeRandomMT19937({{"seed", "123"}}));
+  if (philox) {
+    mc->set(MakeRandomPhilox({{"seed", "123"}}));
+  } else {
+    mc->set(MakeRandomMT19937({{"seed", "123"}}));
+  }
   //mc->set(MakeRandomMT19937({{"seed", "time"}}));
   mc->set(system);
   mc->set(MakeThermoParams({{"beta", "1.2"}, {"chemical_potential", "1."}}));
@@ -131,6 +155,15 @@ TEST(Prefetch, MUVT) {
   prefetch(sys);
 }
 
+TEST(Prefetch, MUVT_philox) {
+  System sys;
+  sys.add(MakeConfiguration({{"cubic_side_length", "8"},
+                             {"particle_type0", "../particle/lj.fstprt"}}));
+  sys.add(MakePotential(MakeLennardJones()));
+  sys.add(MakePotential(MakeLongRangeCorrections()));
+  prefetch(sys, 0, true);
+}
+
 TEST(Prefetch, MUVT_spce) {
   prefetch(spce({{"alpha", str(5.6/20)}, {"kmax_squared", "38"}, {"table_size", str(1e3)}}), 1);
 }
@@ -37,10 +37,17 @@ class CheckEnergy : public ModifyUpdateOnly {
     args:
     - tolerance: relative absolute difference between running energy
       and recomputed energy (default: 1e-10).
+    - file_name: if not empty, append the recomputed energy, running energy
+      and their difference for each configuration upon each check, such as
+      to measure the drift in the running energy (default: empty).
   */
   explicit CheckEnergy(argtype args = argtype());
   explicit CheckEnergy(argtype * args);
 
+  void initialize(Criteria * criteria,
+      System * system,
+      TrialFactory * trial_factory) override;
+
   void update(Criteria * criteria,
       System * system,
       TrialFactory * trial_factory) override;
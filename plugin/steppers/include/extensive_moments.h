@@ -15,12 +15,22 @@ namespace feasst {
 
   where \f$i,k\f$ are particle types, and the powers \f$j,m,p\f$ are collected
   from 0 to a maximum order cutoff.
+
+  In the compact mode, only the number of values and the Kahan-compensated
+  sums of each moment and its square are stored, contiguously, instead of an
+  Accumulator for each moment.
+  Compact moments from independent simulations of the same macrostate may be
+  combined with merge.
+  For example, Clones::extensive_moments merges the moments of overlapping
+  windows.
  */
 class ExtensiveMoments : public Analyze {
  public:
   /**
     args:
     - max_order: maximum order cutoff for the powers (default: 3).
+    - compact: if true, use the compact mode described above
+      (default: false).
    */
   explicit ExtensiveMoments(argtype args = argtype());
   explicit ExtensiveMoments(argtype * args);
@@ -39,15 +49,38 @@ class ExtensiveMoments : public Analyze {
 
   /// Write the moments by serialization of a 5d accumulator.
   /// If checkpoints do not work, this file can be read using feasst_deserialize
+  /// In the compact mode, write a line for each moment with the powers and
+  /// types, number of values, sum and sum of squares.
   std::string write(const Criteria& criteria,
       const System& system,
       const TrialFactory& trial_factory) override;
 
   //const Accumulator& energy() const { return accumulator(); }
-  /// Return the extensive moments
+  /// Return the extensive moments (not compact).
   const Accumulator& moments(const int p, const int m, const int k,
-      const int j, const int i) const {
-    return moments_[p][m][k][j][i]; }
+      const int j, const int i) const;
+
+  /// Return true if in the compact mode.
+  bool is_compact() const { return compact_; }
+
+  /// Return the number of values of each moment.
+  double num_values() const;
+
+  /// Return the sum of a moment.
+  double sum(const int p, const int m, const int k, const int j,
+    const int i) const;
+
+  /// Return the sum of the squares of a moment.
+  double sum_of_squared(const int p, const int m, const int k, const int j,
+    const int i) const;
+
+  /// Return the average of a moment.
+  double average(const int p, const int m, const int k, const int j,
+    const int i) const { return sum(p, m, k, j, i)/num_values(); }
+
+  /// Add the moments of another, compact ExtensiveMoments with the same
+  /// max_order and number of particle types.
+  void merge(const ExtensiveMoments& extensive_moments);
 
   // serialize
   std::string class_name() const override { return std::string("ExtensiveMoments"); }
@@ -61,10 +94,22 @@ class ExtensiveMoments : public Analyze {
 
  private:
   int max_order_;
+  bool compact_;
   // moments_[p][m][k][j][i]
   std::vector<std::vector<std::vector<std::vector<std::vector<Accumulator> > > > > moments_;
   std::vector<double> u_p_;
   std::vector<std::vector<double> > n_i_j_;
+
+  // compact mode, indexed by index_(p, m, k, j, i)
+  int num_ptypes_ = 0;
+  double num_values_ = 0.;
+  std::vector<double> sums_;
+  std::vector<double> sums_comp_;
+  std::vector<double> sums_sq_;
+  std::vector<double> sums_sq_comp_;
+
+  int index_(const int p, const int m, const int k, const int j,
+    const int i) const;
 };
 
 inline std::shared_ptr<ExtensiveMoments> MakeExtensiveMoments(argtype args = argtype()) {
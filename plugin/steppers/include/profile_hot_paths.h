@@ -0,0 +1,62 @@
+
+#ifndef FEASST_STEPPERS_PROFILE_HOT_PATHS_H_
+#define FEASST_STEPPERS_PROFILE_HOT_PATHS_H_
+
+#include "monte_carlo/include/analyze.h"
+
+namespace feasst {
+
+/**
+  Periodically write the hierarchical Profile, summed over all threads, as a
+  table, with the number of calls and the time spent in the selection,
+  perturbation, acceptance and finalization or reversion of each Trial, and
+  the energy of each Potential.
+  With Prefetch, the other threads may still be attempting trials during the
+  write, and the sections they have not finished are not included.
+  Requires compilation with the cmake option -DUSE_PROFILE=ON.
+  Otherwise, the table is empty.
+ */
+class ProfileHotPaths : public Analyze {
+ public:
+  /**
+    args:
+    - reset: if true, reset the profiles of all threads after each write
+      (default: false).
+   */
+  explicit ProfileHotPaths(argtype args = argtype());
+  explicit ProfileHotPaths(argtype * args);
+
+  std::string header(const Criteria& criteria,
+    const System& system,
+    const TrialFactory& trials) const override;
+
+  void initialize(Criteria * criteria,
+      System * system,
+      TrialFactory * trial_factory) override;
+
+  std::string write(const Criteria& criteria,
+      const System& system,
+      const TrialFactory& trial_factory) override;
+
+  // serialize
+  std::string class_name() const override {
+    return std::string("ProfileHotPaths"); }
+  std::shared_ptr<Analyze> create(std::istream& istr) const override {
+    return std::make_shared<ProfileHotPaths>(istr); }
+  std::shared_ptr<Analyze> create(argtype * args) const override {
+    return std::make_shared<ProfileHotPaths>(args); }
+  void serialize(std::ostream& ostr) const override;
+  explicit ProfileHotPaths(std::istream& istr);
+
+ private:
+  bool is_reset_;
+};
+
+inline std::shared_ptr<ProfileHotPaths> MakeProfileHotPaths(
+    argtype args = argtype()) {
+  return std::make_shared<ProfileHotPaths>(args);
+}
+
+}  // namespace feasst
+
+#endif  // FEASST_STEPPERS_PROFILE_HOT_PATHS_H_
@@ -0,0 +1,81 @@
+
+#ifndef FEASST_STEPPERS_THROUGHPUT_H_
+#define FEASST_STEPPERS_THROUGHPUT_H_
+
+#include <chrono>
+#include <vector>
+#include "monte_carlo/include/analyze.h"
+
+namespace feasst {
+
+/**
+  Periodically write a machine-readable time series of performance metrics,
+  as rates or counts over the interval since the previous write:
+
+  - seconds: elapsed wall clock time since the previous write.
+  - trials: number of trials attempted.
+  - trials_per_second: trials divided by seconds.
+  - pairs_per_second: pair interactions evaluated by the VisitModelInner of
+    each Potential, divided by seconds.
+  - cell_updates: number of updates of the cell list by VisitModelCell.
+  - kspace_updates: number of updates of the structure factor by Ewald.
+  - cache_hits: number of Potential energies loaded from the Cache.
+  - memory_kb: the resident set size of the process, as given by VmRSS in
+    /proc/self/status, or -1 if unavailable.
+
+  The first interval begins upon initialization.
+  Counters are not serialized, so the interval after a restart begins upon
+  deserialization.
+ */
+class Throughput : public AnalyzeWriteOnly {
+ public:
+  /**
+    args:
+    - format: "csv" for comma separated values with a header, or "json" for
+      one JSON object per line (default: csv).
+   */
+  explicit Throughput(argtype args = argtype());
+  explicit Throughput(argtype * args);
+
+  std::string header(const Criteria& criteria,
+    const System& system,
+    const TrialFactory& trials) const override;
+
+  void initialize(Criteria * criteria,
+      System * system,
+      TrialFactory * trial_factory) override;
+
+  std::string write(const Criteria& criteria,
+      const System& system,
+      const TrialFactory& trial_factory) override;
+
+  // serialize
+  std::string class_name() const override {
+    return std::string("Throughput"); }
+  std::shared_ptr<Analyze> create(std::istream& istr) const override {
+    return std::make_shared<Throughput>(istr); }
+  std::shared_ptr<Analyze> create(argtype * args) const override {
+    return std::make_shared<Throughput>(args); }
+  void serialize(std::ostream& ostr) const override;
+  explicit Throughput(std::istream& istr);
+
+ private:
+  bool is_json_;
+
+  // temporary and not serialized
+  std::chrono::steady_clock::time_point previous_time_;
+  std::vector<int64_t> previous_;
+
+  // Return the trials, pairs, cell updates, k-space updates and cache hits.
+  std::vector<int64_t> counters_(const System& system,
+    const TrialFactory& trial_factory) const;
+};
+
+inline std::shared_ptr<Throughput> MakeThroughput(
+    argtype args = argtype()) {
+  return std::make_shared<Throughput>(args);
+}
+
+}  // namespace feasst
+
+#endif  // FEASST_STEPPERS_THROUGHPUT_H_
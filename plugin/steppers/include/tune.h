@@ -10,12 +10,29 @@ namespace feasst {
   Each state and trial has a tunable value stored in this object.
   Every update, check if state has changed and replace with stored values.
   Also, Tune the stored values.
+
+  By default, the values are tuned toward the target acceptance of the
+  Tunable.
+  Alternatively, the values may be tuned to maximize the throughput, defined
+  as the mean-squared displacement of the sites of accepted trials per wall
+  time spent in the attempts of that trial.
+  Each tuning window, the value is changed by a fixed fraction in the
+  direction which last increased the throughput, and the direction is
+  reversed if the throughput decreased.
+  If no trials were accepted, the value is decreased.
+  Acceptance is a poor proxy for efficiency at high density or when the cost
+  of a trial depends upon its step size, such as with cell lists.
  */
 class Tune : public Modify {
  public:
   /**
     args:
     - trials_per_tune: number of attempted trials per tune (default: 1e3).
+    - objective: if "acceptance", tune to the target acceptance.
+      If "throughput", tune to maximize the mean-squared displacement per wall
+      time, as described above (default: acceptance).
+    - throughput_percent_change: fractional change of the value each tune for
+      the throughput objective (default: 0.1).
    */
   explicit Tune(argtype args = argtype());
   explicit Tune(argtype * args);
@@ -50,8 +67,17 @@ class Tune : public Modify {
   std::vector<double> values_;
   std::vector<int> num_attempts_;
   std::vector<int> num_accepted_;
+  bool is_throughput_ = false;
+  double throughput_percent_change_ = 0.1;
+  std::vector<double> displacement_sq_;
+  std::vector<double> seconds_;
+  std::vector<double> throughput_;
+  std::vector<int> direction_;
 
   int min_num(const TrialFactory& trial_factory) const;
+  double mean_squared_displacement_(const Trial& trial,
+                                    const System& system) const;
+  double tune_throughput_(const int trial, const double value);
 };
 
 inline std::shared_ptr<Tune> MakeTune(argtype args = argtype()) {
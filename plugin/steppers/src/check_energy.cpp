@@ -16,16 +16,29 @@ static MapCheckEnergy mapper_energy_check_ = MapCheckEnergy();
 CheckEnergy::CheckEnergy(argtype * args) : ModifyUpdateOnly(args) {
   tolerance_ = dble("tolerance", args, 1e-10);
   check_ = MakeCheck();
+  if (!file_name().empty()) {
+    set_append();
+  }
 }
 CheckEnergy::CheckEnergy(argtype args) : CheckEnergy(&args) {
   FEASST_CHECK_ALL_USED(args);
 }
 
+void CheckEnergy::initialize(Criteria * criteria,
+    System * system,
+    TrialFactory * trial_factory) {
+  if (!file_name().empty()) {
+    printer("config,energy,running_energy,difference\n",
+            file_name(*criteria));
+  }
+}
+
 void CheckEnergy::update(Criteria * criteria,
     System * system,
     TrialFactory * trial_factory) {
   check_->update(*criteria, *system, *trial_factory);
   DEBUG("computing unoptimized energy for check");
+  std::stringstream drift;
 
   for (int config = 0; config < system->num_configurations(); ++config) {
     DEBUG("config " << config);
@@ -38,6 +51,8 @@ void CheckEnergy::update(Criteria * criteria,
     );
     // HWH configuration_index_
     accumulator_.accumulate(energy - current_energy);
+    drift << config << "," << MAX_PRECISION << energy << ","
+          << current_energy << "," << energy - current_energy << std::endl;
 
     // loop over each profile and perform the energy check
     const std::vector<double>& energy_profile = system->unoptimized(config).stored_energy_profile();
@@ -74,6 +89,9 @@ void CheckEnergy::update(Criteria * criteria,
 
     // loop over all queryable maps and check those as well.
   }
+  if (!file_name().empty()) {
+    printer(drift.str(), file_name(*criteria));
+  }
 }
 
 void CheckEnergy::serialize(std::ostream& ostr) const {
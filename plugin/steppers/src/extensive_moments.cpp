@@ -15,8 +15,17 @@ class MapExtensiveMoments {
 
 static MapExtensiveMoments mapper_ = MapExtensiveMoments();
 
+// Add a value to a sum with Kahan compensation.
+static void kahan_add_(const double value, double * sum, double * comp) {
+  const double adjusted = value - *comp;
+  const double total = *sum + adjusted;
+  *comp = (total - *sum) - adjusted;
+  *sum = total;
+}
+
 ExtensiveMoments::ExtensiveMoments(argtype * args) : Analyze(args) {
   max_order_ = integer("max_order", args, 3);
+  compact_ = boolean("compact", args, false);
 }
 ExtensiveMoments::ExtensiveMoments(argtype args) : ExtensiveMoments(&args) {
   FEASST_CHECK_ALL_USED(args);
@@ -26,12 +35,26 @@ void ExtensiveMoments::initialize(Criteria * criteria,
     System * system,
     TrialFactory * trial_factory) {
   const int num_ptypes = system->configuration().num_particle_types();
-  resize(max_order_ + 1,
-         max_order_ + 1,
-         num_ptypes,
-         max_order_ + 1,
-         num_ptypes,
-         &moments_);
+  if (compact_) {
+    const int num_orders = max_order_ + 1;
+    const int size = num_orders*num_orders*num_orders*num_ptypes*num_ptypes;
+    if (num_ptypes_ != num_ptypes ||
+        static_cast<int>(sums_.size()) != size) {
+      num_ptypes_ = num_ptypes;
+      num_values_ = 0.;
+      sums_.assign(size, 0.);
+      sums_comp_.assign(size, 0.);
+      sums_sq_.assign(size, 0.);
+      sums_sq_comp_.assign(size, 0.);
+    }
+  } else {
+    resize(max_order_ + 1,
+           max_order_ + 1,
+           num_ptypes,
+           max_order_ + 1,
+           num_ptypes,
+           &moments_);
+  }
   u_p_.resize(max_order_ + 1);
   resize(num_ptypes, max_order_ + 1, &n_i_j_);
   printer(header(*criteria, *system, *trial_factory),
@@ -66,6 +89,22 @@ void ExtensiveMoments::update(const Criteria& criteria,
   }
 
   // accumulate moments
+  if (compact_) {
+    // the loop order matches the contiguous layout of index_
+    int index = 0;
+    for (int p = 0; p <= max_order_; ++p) {
+    for (int m = 0; m <= max_order_; ++m) {
+    for (int k = 0; k < num_ptypes; ++k) {
+    for (int j = 0; j <= max_order_; ++j) {
+    for (int i = 0; i < num_ptypes; ++i) {
+      const double value = n_i_j_[i][j]*n_i_j_[k][m]*u_p_[p];
+      kahan_add_(value, &sums_[index], &sums_comp_[index]);
+      kahan_add_(value*value, &sums_sq_[index], &sums_sq_comp_[index]);
+      ++index;
+    }}}}}
+    num_values_ += 1.;
+    return;
+  }
   for (int p = 0; p <= max_order_; ++p) {
   for (int m = 0; m <= max_order_; ++m) {
   for (int k = 0; k < num_ptypes; ++k) {
@@ -79,26 +118,115 @@ std::string ExtensiveMoments::write(const Criteria& criteria,
     const System& system,
     const TrialFactory& trial_factory) {
   std::stringstream ss;
+  if (compact_) {
+    ss << "p,m,k,j,i,num_values,sum,sum_of_squared" << std::endl;
+    for (int p = 0; p <= max_order_; ++p) {
+    for (int m = 0; m <= max_order_; ++m) {
+    for (int k = 0; k < num_ptypes_; ++k) {
+    for (int j = 0; j <= max_order_; ++j) {
+    for (int i = 0; i < num_ptypes_; ++i) {
+      ss << p << "," << m << "," << k << "," << j << "," << i << ","
+         << MAX_PRECISION << num_values_ << ","
+         << sum(p, m, k, j, i) << ","
+         << sum_of_squared(p, m, k, j, i) << std::endl;
+    }}}}}
+    return ss.str();
+  }
   feasst_serialize_fstobj(moments_, ss);
   return ss.str();
 }
 
+int ExtensiveMoments::index_(const int p, const int m, const int k,
+    const int j, const int i) const {
+  const int num_orders = max_order_ + 1;
+  return (((p*num_orders + m)*num_ptypes_ + k)*num_orders + j)*num_ptypes_
+         + i;
+}
+
+const Accumulator& ExtensiveMoments::moments(const int p, const int m,
+    const int k, const int j, const int i) const {
+  ASSERT(!compact_, "moments are not available in the compact mode");
+  return moments_[p][m][k][j][i];
+}
+
+double ExtensiveMoments::num_values() const {
+  if (compact_) {
+    return num_values_;
+  }
+  return moments_[0][0][0][0][0].num_values();
+}
+
+double ExtensiveMoments::sum(const int p, const int m, const int k,
+    const int j, const int i) const {
+  if (compact_) {
+    const int index = index_(p, m, k, j, i);
+    return sums_[index] - sums_comp_[index];
+  }
+  return moments_[p][m][k][j][i].sum_dble();
+}
+
+double ExtensiveMoments::sum_of_squared(const int p, const int m,
+    const int k, const int j, const int i) const {
+  if (compact_) {
+    const int index = index_(p, m, k, j, i);
+    return sums_sq_[index] - sums_sq_comp_[index];
+  }
+  return moments_[p][m][k][j][i].sum_of_squared_dble();
+}
+
+void ExtensiveMoments::merge(const ExtensiveMoments& extensive_moments) {
+  ASSERT(compact_ && extensive_moments.compact_,
+    "merge requires the compact mode");
+  ASSERT(max_order_ == extensive_moments.max_order_ &&
+         num_ptypes_ == extensive_moments.num_ptypes_ &&
+         sums_.size() == extensive_moments.sums_.size(),
+    "merge requires the same max_order and number of particle types");
+  for (int index = 0; index < static_cast<int>(sums_.size()); ++index) {
+    kahan_add_(extensive_moments.sums_[index],
+               &sums_[index], &sums_comp_[index]);
+    kahan_add_(-extensive_moments.sums_comp_[index],
+               &sums_[index], &sums_comp_[index]);
+    kahan_add_(extensive_moments.sums_sq_[index],
+               &sums_sq_[index], &sums_sq_comp_[index]);
+    kahan_add_(-extensive_moments.sums_sq_comp_[index],
+               &sums_sq_[index], &sums_sq_comp_[index]);
+  }
+  num_values_ += extensive_moments.num_values_;
+}
+
 void ExtensiveMoments::serialize(std::ostream& ostr) const {
   Stepper::serialize(ostr);
-  feasst_serialize_version(1647, ostr);
+  feasst_serialize_version(1648, ostr);
   feasst_serialize(max_order_, ostr);
   feasst_serialize_fstobj(moments_, ostr);
   feasst_serialize(u_p_, ostr);
   feasst_serialize(n_i_j_, ostr);
+  feasst_serialize(compact_, ostr);
+  feasst_serialize(num_ptypes_, ostr);
+  feasst_serialize(num_values_, ostr);
+  feasst_serialize(sums_, ostr);
+  feasst_serialize(sums_comp_, ostr);
+  feasst_serialize(sums_sq_, ostr);
+  feasst_serialize(sums_sq_comp_, ostr);
 }
 
 ExtensiveMoments::ExtensiveMoments(std::istream& istr) : Analyze(istr) {
   const int version = feasst_deserialize_version(istr);
-  ASSERT(version == 1647, "mismatch version:" << version);
+  ASSERT(version >= 1647 && version <= 1648, "mismatch version:" << version);
   feasst_deserialize(&max_order_, istr);
   feasst_deserialize_fstobj(&moments_, istr);
   feasst_deserialize(&u_p_, istr);
   feasst_deserialize(&n_i_j_, istr);
+  compact_ = false;
+  if (version >= 1648) {
+    feasst_deserialize(&compact_, istr);
+    feasst_deserialize(&num_ptypes_, istr);
+    feasst_deserialize(&num_values_, istr);
+    feasst_deserialize(&sums_, istr);
+    feasst_deserialize(&sums_comp_, istr);
+    feasst_deserialize(&sums_sq_, istr);
+    feasst_deserialize(&sums_sq_comp_, istr);
+  }
 }
 
 ExtensiveMoments::ExtensiveMoments(const Analyze& extensive_moments) {
@@ -0,0 +1,64 @@
+#include "utils/include/serialize.h"
+#include "utils/include/profile.h"
+#include "steppers/include/profile_hot_paths.h"
+
+namespace feasst {
+
+class MapProfileHotPaths {
+ public:
+  MapProfileHotPaths() {
+    auto obj = MakeProfileHotPaths();
+    obj->deserialize_map()["ProfileHotPaths"] = obj;
+  }
+};
+
+static MapProfileHotPaths mapper_ = MapProfileHotPaths();
+
+ProfileHotPaths::ProfileHotPaths(argtype * args) : Analyze(args) {
+  is_reset_ = boolean("reset", args, false);
+}
+ProfileHotPaths::ProfileHotPaths(argtype args) : ProfileHotPaths(&args) {
+  FEASST_CHECK_ALL_USED(args);
+}
+
+void ProfileHotPaths::initialize(Criteria * criteria,
+    System * system,
+    TrialFactory * trial_factory) {
+  #ifndef FEASST_PROFILE_
+    WARN("ProfileHotPaths requires compilation with -DUSE_PROFILE=ON");
+  #endif  // FEASST_PROFILE_
+  printer(header(*criteria, *system, *trial_factory),
+          file_name(*criteria));
+}
+
+// The table written by Profile includes the header.
+std::string ProfileHotPaths::header(const Criteria& criteria,
+    const System& system,
+    const TrialFactory& trial_factory) const {
+  return std::string("");
+}
+
+std::string ProfileHotPaths::write(const Criteria& criteria,
+    const System& system,
+    const TrialFactory& trial_factory) {
+  const std::string table = Profile::merged().str();
+  if (is_reset_) {
+    Profile::reset_all();
+  }
+  DEBUG(table);
+  return table;
+}
+
+void ProfileHotPaths::serialize(std::ostream& ostr) const {
+  Stepper::serialize(ostr);
+  feasst_serialize_version(4719, ostr);
+  feasst_serialize(is_reset_, ostr);
+}
+
+ProfileHotPaths::ProfileHotPaths(std::istream& istr) : Analyze(istr) {
+  const int version = feasst_deserialize_version(istr);
+  ASSERT(version == 4719, "mismatch version:" << version);
+  feasst_deserialize(&is_reset_, istr);
+}
+
+}  // namespace feasst
@@ -0,0 +1,157 @@
+#include <fstream>
+#include "utils/include/serialize.h"
+#include "system/include/visit_model.h"
+#include "system/include/visit_model_inner.h"
+#include "system/include/potential_factory.h"
+#include "system/include/system.h"
+#include "monte_carlo/include/trial_factory.h"
+#include "steppers/include/throughput.h"
+
+namespace feasst {
+
+class MapThroughput {
+ public:
+  MapThroughput() {
+    auto obj = MakeThroughput();
+    obj->deserialize_map()["Throughput"] = obj;
+  }
+};
+
+static MapThroughput mapper_ = MapThroughput();
+
+Throughput::Throughput(argtype * args) : AnalyzeWriteOnly(args) {
+  if (boolean("append", args, true)) {
+    set_append();
+  } else {
+    ERROR("append is required");
+  }
+  const std::string format = str("format", args, "csv");
+  if (format == "csv") {
+    is_json_ = false;
+  } else if (format == "json") {
+    is_json_ = true;
+  } else {
+    FATAL("unrecognized format: " << format);
+  }
+}
+Throughput::Throughput(argtype args) : Throughput(&args) {
+  FEASST_CHECK_ALL_USED(args);
+}
+
+void Throughput::initialize(Criteria * criteria,
+    System * system,
+    TrialFactory * trial_factory) {
+  printer(header(*criteria, *system, *trial_factory),
+          file_name(*criteria));
+  previous_ = counters_(*system, *trial_factory);
+  previous_time_ = std::chrono::steady_clock::now();
+}
+
+std::string Throughput::header(const Criteria& criteria,
+    const System& system,
+    const TrialFactory& trial_factory) const {
+  if (is_json_) {
+    return std::string("");
+  }
+  return std::string("seconds,trials,trials_per_second,pairs_per_second,"
+    "cell_updates,kspace_updates,cache_hits,memory_kb\n");
+}
+
+std::vector<int64_t> Throughput::counters_(const System& system,
+    const TrialFactory& trial_factory) const {
+  std::vector<int64_t> counters(5, 0);
+  counters[0] = trial_factory.num_attempts();
+  for (int config = 0; config < system.num_configurations(); ++config) {
+    for (const std::shared_ptr<Potential>& pot :
+         system.potentials(config).potentials()) {
+      const VisitModel& visit = pot->visit_model();
+      counters[1] += visit.inner().num_pairs();
+      if (visit.class_name() == "VisitModelCell") {
+        counters[2] += visit.num_updates();
+      } else if (visit.class_name() == "Ewald") {
+        counters[3] += visit.num_updates();
+      }
+      counters[4] += pot->num_cache_hits();
+    }
+  }
+  return counters;
+}
+
+// Return the resident set size in kB, or -1 if unavailable.
+static int64_t resident_set_kb_() {
+  std::ifstream file("/proc/self/status");
+  std::string line;
+  while (std::getline(file, line)) {
+    if (line.compare(0, 6, "VmRSS:") == 0) {
+      std::stringstream ss(line.substr(6));
+      int64_t kb = -1;
+      ss >> kb;
+      return kb;
+    }
+  }
+  return -1;
+}
+
+std::string Throughput::write(const Criteria& criteria,
+    const System& system,
+    const TrialFactory& trial_factory) {
+  const std::chrono::steady_clock::time_point now =
+    std::chrono::steady_clock::now();
+  const double seconds = std::chrono::duration<double>(
+    now - previous_time_).count();
+  const std::vector<int64_t> counters = counters_(system, trial_factory);
+  if (previous_.size() != counters.size()) {
+    previous_ = std::vector<int64_t>(counters.size(), 0);
+  }
+  std::vector<int64_t> delta(counters.size());
+  for (int index = 0; index < static_cast<int>(counters.size()); ++index) {
+    // counters may decrease, for example, when a Potential is reinitialized.
+    delta[index] = std::max(int64_t(0), counters[index] - previous_[index]);
+  }
+  double trials_per_second = 0., pairs_per_second = 0.;
+  if (seconds > 0.) {
+    trials_per_second = static_cast<double>(delta[0])/seconds;
+    pairs_per_second = static_cast<double>(delta[1])/seconds;
+  }
+  const int64_t memory_kb = resident_set_kb_();
+  std::stringstream ss;
+  if (is_json_) {
+    ss << "{\"seconds\":" << seconds
+       << ",\"trials\":" << delta[0]
+       << ",\"trials_per_second\":" << trials_per_second
+       << ",\"pairs_per_second\":" << pairs_per_second
+       << ",\"cell_updates\":" << delta[2]
+       << ",\"kspace_updates\":" << delta[3]
+       << ",\"cache_hits\":" << delta[4]
+       << ",\"memory_kb\":" << memory_kb
+       << "}" << std::endl;
+  } else {
+    ss << seconds << ","
+       << delta[0] << ","
+       << trials_per_second << ","
+       << pairs_per_second << ","
+       << delta[2] << ","
+       << delta[3] << ","
+       << delta[4] << ","
+       << memory_kb << std::endl;
+  }
+  previous_ = counters;
+  previous_time_ = now;
+  DEBUG(ss.str());
+  return ss.str();
+}
+
+void Throughput::serialize(std::ostream& ostr) const {
+  Stepper::serialize(ostr);
+  feasst_serialize_version(6290, ostr);
+  feasst_serialize(is_json_, ostr);
+}
+
+Throughput::Throughput(std::istream& istr) : AnalyzeWriteOnly(istr) {
+  const int version = feasst_deserialize_version(istr);
+  ASSERT(version == 6290, "mismatch version:" << version);
+  feasst_deserialize(&is_json_, istr);
+  previous_time_ = std::chrono::steady_clock::now();
+}
+
+}  // namespace feasst
@@ -1,5 +1,7 @@
-#include "steppers/include/tune.h"
 #include "utils/include/serialize.h"
+#include "configuration/include/domain.h"
+#include "monte_carlo/include/trial_factory.h"
+#include "steppers/include/tune.h"
 
 namespace feasst {
 
@@ -15,25 +17,46 @@ static MapTune mapper_ = MapTune();
 Tune::Tune(argtype * args) : Modify(args) {
   trials_per_tune_ = integer("trials_per_tune", args, 1e3);
   ASSERT(trials_per_update() == 1, "requires 1 trial per update");
+  const std::string objective = str("objective", args, "acceptance");
+  if (objective == "throughput") {
+    is_throughput_ = true;
+  } else {
+    ASSERT(objective == "acceptance", "unrecognized objective: " << objective);
+  }
+  throughput_percent_change_ = dble("throughput_percent_change", args, 0.1);
 }
 Tune::Tune(argtype args) : Tune(&args) { FEASST_CHECK_ALL_USED(args); }
 
 void Tune::serialize(std::ostream& ostr) const {
   Stepper::serialize(ostr);
-  feasst_serialize_version(256, ostr);
+  feasst_serialize_version(257, ostr);
   feasst_serialize(trials_per_tune_, ostr);
   feasst_serialize(values_, ostr);
   feasst_serialize(num_attempts_, ostr);
   feasst_serialize(num_accepted_, ostr);
+  feasst_serialize(is_throughput_, ostr);
+  feasst_serialize(throughput_percent_change_, ostr);
+  feasst_serialize(displacement_sq_, ostr);
+  feasst_serialize(seconds_, ostr);
+  feasst_serialize(throughput_, ostr);
+  feasst_serialize(direction_, ostr);
 }
 
 Tune::Tune(std::istream& istr) : Modify(istr) {
   const int version = feasst_deserialize_version(istr);
-  ASSERT(version == 256, "version mismatch:" << version);
+  ASSERT(version >= 256 && version <= 257, "version mismatch:" << version);
   feasst_deserialize(&trials_per_tune_, istr);
   feasst_deserialize(&values_, istr);
   feasst_deserialize(&num_attempts_, istr);
   feasst_deserialize(&num_accepted_, istr);
+  if (version >= 257) {
+    feasst_deserialize(&is_throughput_, istr);
+    feasst_deserialize(&throughput_percent_change_, istr);
+    feasst_deserialize(&displacement_sq_, istr);
+    feasst_deserialize(&seconds_, istr);
+    feasst_deserialize(&throughput_, istr);
+    feasst_deserialize(&direction_, istr);
+  }
 }
 
 void Tune::initialize(Criteria * criteria,
@@ -43,6 +66,13 @@ void Tune::initialize(Criteria * criteria,
   values_.resize(num_trials);
   num_attempts_.resize(num_trials, 0);
   num_accepted_.resize(num_trials, 0);
+  displacement_sq_.resize(num_trials, 0.);
+  seconds_.resize(num_trials, 0.);
+  throughput_.resize(num_trials, -1.);
+  direction_.resize(num_trials, 1);
+  if (is_throughput_) {
+    trial_factory->time_next_attempt();
+  }
   for (int trial = 0; trial < num_trials; ++trial) {
     if (trial_factory->trial(trial).num_stages() > 0) {
       values_[trial] = trial_factory->trial(trial).stage(0).perturb().tunable().value();
@@ -55,6 +85,9 @@ void Tune::initialize(Criteria * criteria,
 void Tune::update(Criteria * criteria,
     System * system,
     TrialFactory * trial_factory) {
+  if (is_throughput_) {
+    trial_factory->time_next_attempt();
+  }
   const int trial = trial_factory->last_index();
   if (trial < min_num(*trial_factory)) {
     if (!trial_factory->trial(trial).accept().reject()) {
@@ -66,6 +99,13 @@ void Tune::update(Criteria * criteria,
       if (criteria->was_accepted()) {
         *num_accepted += 1;
       }
+      if (is_throughput_) {
+        seconds_[trial] += trial_factory->last_seconds();
+        if (criteria->was_accepted()) {
+          displacement_sq_[trial] +=
+            mean_squared_displacement_(trial_factory->trial(trial), *system);
+        }
+      }
 
       // check for tuning
       if (trial_factory->trial(trial).num_stages() > 0) {
@@ -80,7 +120,11 @@ void Tune::update(Criteria * criteria,
                   static_cast<double>(*num_attempts);
             DEBUG("acceptance: " << acceptance);
             double val = *value;
-            val *= 1 + tunable.percent_change()*(acceptance - tunable.target());
+            if (is_throughput_) {
+              val = tune_throughput_(trial, val);
+            } else {
+              val *= 1 + tunable.percent_change()*(acceptance - tunable.target());
+            }
             if (!tunable.is_bound() ||
                 (val <= tunable.max() && val >= tunable.min())) {
               *value = val;
@@ -132,6 +176,60 @@ std::string Tune::write(Criteria * criteria,
   return ss.str();
 }
 
+// Return the mean-squared displacement of the sites of all stages.
+double Tune::mean_squared_displacement_(const Trial& trial,
+                                        const System& system) const {
+  double sum = 0.;
+  int num_sites = 0;
+  Position rel, pbc;
+  double r2;
+  for (int istage = 0; istage < trial.num_stages(); ++istage) {
+    const TrialSelect& select = trial.stage(istage).trial_select();
+    const Select& mobile = select.mobile();
+    const Select& original = select.mobile_original();
+    if (mobile.num_particles() != original.num_particles()) continue;
+    const Domain& domain = select.configuration(system).domain();
+    rel.set_to_origin(domain.dimension());
+    pbc.set_to_origin(domain.dimension());
+    for (int part = 0; part < mobile.num_particles(); ++part) {
+      const std::vector<Position>& new_pos = mobile.site_positions()[part];
+      const std::vector<Position>& old_pos = original.site_positions()[part];
+      const int num = std::min(new_pos.size(), old_pos.size());
+      for (int site = 0; site < num; ++site) {
+        if (domain.is_tilted()) {
+          domain.wrap_triclinic_opt(new_pos[site], old_pos[site], &rel,
+                                    &pbc, &r2);
+        } else {
+          domain.wrap_opt(new_pos[site], old_pos[site], &rel, &pbc, &r2);
+        }
+        sum += r2;
+        ++num_sites;
+      }
+    }
+  }
+  if (num_sites == 0) return 0.;
+  return sum/static_cast<double>(num_sites);
+}
+
+double Tune::tune_throughput_(const int trial, const double value) {
+  double val = value;
+  if (seconds_[trial] > 0.) {
+    const double throughput = displacement_sq_[trial]/seconds_[trial];
+    DEBUG("throughput: " << throughput);
+    if (throughput <= 0.) {
+      // without any accepted displacement, the step is too large
+      direction_[trial] = -1;
+    } else if (throughput < throughput_[trial]) {
+      direction_[trial] *= -1;
+    }
+    throughput_[trial] = throughput;
+    val *= 1. + direction_[trial]*throughput_percent_change_;
+  }
+  displacement_sq_[trial] = 0.;
+  seconds_[trial] = 0.;
+  return val;
+}
+
 int Tune::min_num(const TrialFactory& trial_factory) const {
   return std::min(trial_factory.num(), static_cast<int>(values_.size()));
 }
@@ -0,0 +1,71 @@
+#include "utils/test/utils.h"
+#include "math/include/random_mt19937.h"
+#include "system/include/lennard_jones.h"
+#include "system/include/long_range_corrections.h"
+#include "monte_carlo/include/monte_carlo.h"
+#include "monte_carlo/include/metropolis.h"
+#include "monte_carlo/include/trial_translate.h"
+#include "monte_carlo/include/trial_transfer.h"
+#include "steppers/include/extensive_moments.h"
+
+namespace feasst {
+
+MonteCarlo gce_moments(const std::string& seed) {
+  MonteCarlo mc;
+  mc.set(MakeRandomMT19937({{"seed", seed}}));
+  mc.add(MakeConfiguration({{"cubic_side_length", "8"},
+                            {"particle_type0", "../particle/lj.fstprt"}}));
+  mc.add(MakePotential(MakeLennardJones()));
+  mc.add(MakePotential(MakeLongRangeCorrections()));
+  mc.set(MakeThermoParams({{"beta", "1.2"}, {"chemical_potential", "-2."}}));
+  mc.set(MakeMetropolis());
+  mc.add(MakeTrialTranslate({{"tunable_param", "1."}}));
+  mc.add(MakeTrialTransfer({{"particle_type", "0"}}));
+  mc.add(MakeExtensiveMoments({{"trials_per_update", "1"}, {"max_order", "2"}}));
+  mc.add(MakeExtensiveMoments({{"trials_per_update", "1"}, {"max_order", "2"},
+                               {"compact", "true"}}));
+  return mc;
+}
+
+TEST(ExtensiveMoments, compact) {
+  MonteCarlo mc = gce_moments("123");
+  mc.attempt(1e3);
+  const auto& moments = dynamic_cast<const ExtensiveMoments&>(mc.analyze(0));
+  const auto& compact = dynamic_cast<const ExtensiveMoments&>(mc.analyze(1));
+  EXPECT_FALSE(moments.is_compact());
+  EXPECT_TRUE(compact.is_compact());
+  EXPECT_EQ(moments.num_values(), compact.num_values());
+  for (int p = 0; p <= 2; ++p) {
+    for (int m = 0; m <= 2; ++m) {
+      for (int j = 0; j <= 2; ++j) {
+        EXPECT_NEAR(moments.moments(p, m, 0, j, 0).sum_dble(),
+                    compact.sum(p, m, 0, j, 0), 1e-6);
+        EXPECT_NEAR(moments.moments(p, m, 0, j, 0).sum_of_squared_dble(),
+                    compact.sum_of_squared(p, m, 0, j, 0), 1e-6);
+        EXPECT_NEAR(moments.moments(p, m, 0, j, 0).average(),
+                    compact.average(p, m, 0, j, 0), 1e-8);
+      }
+    }
+  }
+  TRY(
+    compact.moments(0, 0, 0, 0, 0);
+    CATCH_PHRASE("not available in the compact mode");
+  );
+
+  MonteCarlo mc2 = gce_moments("456");
+  mc2.attempt(1e3);
+  const auto& compact2 = dynamic_cast<const ExtensiveMoments&>(mc2.analyze(1));
+  auto merged = test_serialize<ExtensiveMoments, Analyze>(compact);
+  auto merged_moments = std::dynamic_pointer_cast<ExtensiveMoments>(merged);
+  merged_moments->merge(compact2);
+  EXPECT_DOUBLE_EQ(compact.num_values() + compact2.num_values(),
+                   merged_moments->num_values());
+  EXPECT_NEAR(compact.sum(2, 1, 0, 1, 0) + compact2.sum(2, 1, 0, 1, 0),
+              merged_moments->sum(2, 1, 0, 1, 0), 1e-8);
+  TRY(
+    merged_moments->merge(moments);
+    CATCH_PHRASE("merge requires the compact mode");
+  );
+}
+
+}  // namespace feasst
@@ -0,0 +1,33 @@
+#include <thread>
+#include "utils/test/utils.h"
+#include "utils/include/profile.h"
+#include "system/include/system.h"
+#include "monte_carlo/include/metropolis.h"
+#include "monte_carlo/include/trial_factory.h"
+#include "steppers/include/profile_hot_paths.h"
+
+namespace feasst {
+
+TEST(ProfileHotPaths, serialize) {
+  auto profile = MakeProfileHotPaths({{"reset", "true"},
+                                      {"file_name", "tmp/profile.csv"}});
+  auto profile2 = test_serialize<ProfileHotPaths, Analyze>(*profile);
+}
+
+TEST(ProfileHotPaths, threads) {
+  Profile::reset_all();
+  std::thread thread([]() {
+    ProfileScope scope(Profile::section("ProfileHotPathsThread"));
+  });
+  thread.join();
+  Metropolis criteria;
+  System system;
+  TrialFactory trials;
+  auto profile = MakeProfileHotPaths({{"reset", "true"}});
+  std::string table = profile->write(criteria, system, trials);
+  EXPECT_NE(std::string::npos, table.find("ProfileHotPathsThread,1,"));
+  table = profile->write(criteria, system, trials);
+  EXPECT_NE(std::string::npos, table.find("ProfileHotPathsThread,0,"));
+}
+
+}  // namespace feasst
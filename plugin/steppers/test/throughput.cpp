@@ -0,0 +1,60 @@
+#include <fstream>
+#include "utils/test/utils.h"
+#include "system/include/lennard_jones.h"
+#include "monte_carlo/include/monte_carlo.h"
+#include "monte_carlo/include/run.h"
+#include "monte_carlo/include/metropolis.h"
+#include "monte_carlo/include/trial_add.h"
+#include "monte_carlo/include/trial_translate.h"
+#include "steppers/include/throughput.h"
+
+namespace feasst {
+
+TEST(Throughput, serialize) {
+  auto throughput = MakeThroughput({{"format", "json"},
+                                    {"file_name", "tmp/throughput.json"}});
+  auto throughput2 = test_serialize<Throughput, Analyze>(*throughput);
+  TRY(
+    MakeThroughput({{"format", "xml"}});
+    CATCH_PHRASE("unrecognized format");
+  );
+}
+
+TEST(Throughput, lj) {
+  MonteCarlo mc;
+  mc.add(MakeConfiguration({{"cubic_side_length", "8"},
+                            {"particle_type0", "../particle/lj.fstprt"}}));
+  mc.add(MakePotential(MakeLennardJones()));
+  mc.set(MakeThermoParams({{"beta", "1.2"}, {"chemical_potential", "1."}}));
+  mc.set(MakeMetropolis());
+  mc.add(MakeTrialTranslate({{"weight", "1."}, {"tunable_param", "1."}}));
+  mc.add(MakeTrialAdd({{"particle_type", "0"}}));
+  mc.run(MakeRun({{"until_num_particles", "20"}}));
+  mc.run(MakeRemoveTrial({{"name", "TrialAdd"}}));
+  std::remove("tmp/throughput.csv");
+  mc.add(MakeThroughput({{"trials_per_write", "100"},
+                         {"file_name", "tmp/throughput.csv"},
+                         {"append", "true"}}));
+  mc.attempt(300);
+  std::ifstream file("tmp/throughput.csv");
+  std::string line;
+  std::getline(file, line);
+  EXPECT_EQ(0, static_cast<int>(line.find("seconds,trials,")));
+  int num_lines = 0;
+  while (std::getline(file, line)) {
+    std::stringstream ss(line);
+    std::vector<double> values;
+    std::string value;
+    while (std::getline(ss, value, ',')) {
+      values.push_back(std::stod(value));
+    }
+    ASSERT_EQ(8, static_cast<int>(values.size()));
+    EXPECT_EQ(100, static_cast<int>(values[1]));
+    EXPECT_GT(values[3], 0.);
+    EXPECT_EQ(0, static_cast<int>(values[4]));
+    ++num_lines;
+  }
+  EXPECT_EQ(3, num_lines);
+}
+
+}  // namespace feasst
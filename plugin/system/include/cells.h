@@ -64,14 +64,25 @@ class Cells {
   void set_type(const int type) { type_ = type; }
 
   void add(const Select& select, const int cell) {
-    particles_[cell].add(select); }
+    particles_[cell].add(select);
+    update_empty_(cell); }
   void remove(const Select& select, const int cell) {
-    particles_[cell].remove(select); }
+    particles_[cell].remove(select);
+    update_empty_(cell); }
   void update(const Select& select, const int cell_new, const int cell_old) {
     particles_[cell_old].remove(select);
     particles_[cell_new].add(select);
+    update_empty_(cell_old);
+    update_empty_(cell_new);
   }
 
+  /// Return the number of cells without any sites.
+  int num_empty() const { return static_cast<int>(empty_.size()); }
+
+  /// Return the cell indices without any sites, in no particular order.
+  /// The list is updated incrementally as sites are added or removed.
+  const std::vector<int>& empty() const { return empty_; }
+
   std::string str() const;
 
   void serialize(std::ostream& ostr) const;
@@ -89,6 +100,16 @@ class Cells {
   std::vector<std::vector<int> > neighbor_;
   std::vector<Select> particles_;  // particles for each cell
 
+  // not serialized, but rebuilt from particles_
+  std::vector<int> empty_;
+  std::vector<int> empty_index_;  // index in empty_ or -1 for each cell
+
+  // Update the list of empty cells after the cell is changed.
+  void update_empty_(const int cell);
+
+  // Build the list of empty cells from scratch.
+  void build_empty_();
+
   /// Return the unique cell id number for a given cell vector.
   int id_(std::vector<int> position);
 
@@ -115,6 +115,10 @@ class EnergyMap {
   virtual void synchronize_(const EnergyMap& map, const Select& perturbed);
   const SynchronizeData& data() const { return data_; }
 
+  // Return true if synchronize_ reproduces the accepted move of particles
+  // without repeating the trial.
+  virtual bool is_synchronize_complete() const { return false; }
+
   // serialization
   virtual std::string class_name() const { return class_name_; }
   virtual void serialize(std::ostream& ostr) const {
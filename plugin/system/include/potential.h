@@ -114,6 +114,16 @@ class Potential {
   /// Compute the energy of a selection of the configuration.
   virtual double select_energy(const Select& select, Configuration * config);
 
+  /**
+    Compute the energy of a selection at each of the candidate positions.
+    See VisitModel::compute_candidates.
+    The cache is not used, and the stored energy is not changed.
+   */
+  void select_energies(const Select& select,
+    const std::vector<std::vector<Position> >& candidates,
+    Configuration * config,
+    std::vector<double> * energies);
+
   /// Return the last computed value of the energy.
   double stored_energy() const { return stored_energy_; }
 
@@ -141,8 +151,15 @@ class Potential {
   void unload_cache(const Potential& potential) {
     cache_.set_unload(potential.cache()); }
 
+  /// Return the number of energies unloaded from the Cache.
+  int64_t num_cache_hits() const { return num_cache_hits_; }
+
   void synchronize_(const Potential& potential, const Select& perturbed);
 
+  /// Return true if synchronize_ reproduces an accepted move of particles.
+  bool is_synchronize_complete() const {
+    return visit_model_->is_synchronize_complete(); }
+
   void check(const Configuration& config) const;
 
   void set_visit_model_(std::shared_ptr<VisitModel> visit) {
@@ -167,6 +184,9 @@ class Potential {
   bool prevent_cache_;
   int table_size_;
   argtype override_args_;
+
+  // temporary and not serialized
+  int64_t num_cache_hits_ = 0;
 };
 
 inline std::shared_ptr<Potential> MakePotential(argtype args = argtype()) {
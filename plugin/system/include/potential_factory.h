@@ -53,6 +53,13 @@ class PotentialFactory {
   /// Compute the energy of the selection in the configuration.
   double select_energy(const Select& select, Configuration * config);
 
+  /// Compute the energy of the selection at each of the candidate positions,
+  /// summed over all potentials.
+  void select_energies(const Select& select,
+    const std::vector<std::vector<Position> >& candidates,
+    Configuration * config,
+    std::vector<double> * energies);
+
   /// Return the profile of energies that were last computed.
   std::vector<double> stored_energy_profile() const;
 
@@ -79,6 +86,10 @@ class PotentialFactory {
 
   void synchronize_(const PotentialFactory& factory, const Select& perturbed);
 
+  /// Return true if synchronize_ reproduces an accepted move of particles
+  /// for all potentials.
+  bool is_synchronize_complete() const;
+
   void check(const Configuration& config) const;
 
   /// Serialize.
@@ -91,7 +102,11 @@ class PotentialFactory {
  private:
   std::vector<std::shared_ptr<Potential> > potentials_;
   int opt_overlap_ = 1;
+  std::vector<double> energies_;  // temporary
+  std::vector<int> profile_sections_;  // temporary
 //  Timer timer_;
+
+  int profile_section_(const int index);
 };
 
 }  // namespace feasst
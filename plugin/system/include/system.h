@@ -168,6 +168,17 @@ class System {
   /// But do not finalize this energy (e.g., Ewald, neighbors, etc).
   double perturbed_energy(const Select& select, const int config = 0);
 
+  /**
+    Return the energies of the selection at each candidate position.
+    See Potential::select_energies.
+    The bond energy of the current positions is added to each candidate, and
+    thus the candidates should only differ by rigid translation or rotation.
+   */
+  void perturbed_energies(const Select& select,
+    const std::vector<std::vector<Position> >& candidates,
+    std::vector<double> * energies,
+    const int config = 0);
+
   /// Return the last computed energy.
   double stored_energy(const int config = 0) const {
     return potentials(config).stored_energy(); }
@@ -245,6 +256,10 @@ class System {
 
   void synchronize_(const System& system, const Select& perturbed);
 
+  /// Return true if synchronize_, followed by finalize, reproduces an
+  /// accepted move of particles without repeating the trial.
+  bool is_synchronize_complete() const;
+
   /// Return the header of the status for periodic output.
   std::string status_header() const;
 
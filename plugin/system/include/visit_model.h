@@ -7,6 +7,7 @@
 #include <map>
 #include <sstream>
 #include "math/include/position.h"
+#include "configuration/include/select.h"
 #include "system/include/synchronize_data.h"
 #include "system/include/visit_model_inner.h"
 
@@ -14,6 +15,7 @@ namespace feasst {
 
 class Domain;
 class Configuration;
+class Model;
 class ModelOneBody;
 class ModelTwoBody;
 class ModelThreeBody;
@@ -109,6 +111,25 @@ class VisitModel {
     Position * relative,
     Position * pbc);
 
+  /**
+    Compute the energy of the selection at each of a number of candidate
+    positions, such as the steps of configurational bias or test insertions.
+    Each candidate contains the positions of the sites in the selection, in
+    order of the particles and then sites of the selection.
+    The energy of each candidate is returned in energies, and the positions
+    in the Configuration are restored.
+    The state of the VisitModel corresponds to none of the candidates.
+    Thus, compute the energy of the chosen candidate before finalize.
+   */
+  virtual void compute_candidates(
+      Model * model,
+      const ModelParams& model_params,
+      const Select& selection,
+      const std::vector<std::vector<Position> >& candidates,
+      Configuration * config,
+      const int group_index,
+      std::vector<double> * energies);
+
   /// Return the energy.
   double energy() const { return energy_; }
 
@@ -143,11 +164,22 @@ class VisitModel {
   // Typically used with prefetch.
   virtual void synchronize_(const VisitModel& visit, const Select& perturbed);
   const SynchronizeData& data() const { return data_; }
+
+  // Return true if synchronize_, followed by finalize, reproduces the
+  // accepted move of particles without repeating the trial.
+  // Derived classes with state outside of data_ should return false, unless
+  // synchronize_ is overridden to copy that state.
+  virtual bool is_synchronize_complete() const {
+    return inner_->is_synchronize_complete(); }
   const SynchronizeData& manual_data() const { return manual_data_; }
 
   /// Change the volume.
   virtual void change_volume(const double delta_volume, const int dimension) {}
 
+  /// Return the number of updates of auxiliary data structures since
+  /// construction, such as cell lists or structure factors.
+  virtual int64_t num_updates() const { return 0; }
+
   /// Return the ModelParams index of epsilon.
   int epsilon_index() const { return epsilon_index_; }
 
@@ -191,6 +223,16 @@ class VisitModel {
   SynchronizeData data_;  // all data is copied at synchronization
   SynchronizeData manual_data_;  // data is manually copied
 
+  // Store the positions of the selection, to be restored after candidates.
+  void store_candidates_(const Select& selection, const Configuration& config);
+
+  // Update the positions of the selection to those of a candidate.
+  void load_candidate_(const std::vector<Position>& candidate,
+                       Configuration * config);
+
+  // Restore the positions of the selection before the candidates.
+  void restore_candidates_(Configuration * config);
+
  private:
   double energy_ = 0.;
   std::shared_ptr<VisitModelInner> inner_;
@@ -199,6 +241,9 @@ class VisitModel {
   int cutoff_index_ = -1;
   int charge_index_ = -1;
   double energy_cutoff_;
+
+  // temporary and not serialized
+  Select original_, candidate_;
 };
 
 inline std::shared_ptr<VisitModel> MakeVisitModel(argtype args = argtype()) {
@@ -9,6 +9,8 @@
 
 namespace feasst {
 
+class Random;
+
 /**
   Compute many-body inter-particle interactions using a cell list.
  */
@@ -41,6 +43,25 @@ class VisitModelCell : public VisitModel {
   /// Same as above, but optimized.
   int cell_id_opt_(const Domain& domain, const Position& position);
 
+  /// Return the volume of a cell.
+  double cell_volume(const Domain& domain) const;
+
+  /// Return a uniform random position in a uniform random empty cell.
+  /// Cells::num_empty must be greater than zero.
+  void random_position_in_empty_cell(const Domain& domain,
+    Random * random,
+    Position * position) const;
+
+  /// Return the number of empty cells, if the particle was removed.
+  int num_empty_without(const int particle_index,
+                        const Configuration& config) const;
+
+  /// Return true if the cell of the position is empty, if the particle was
+  /// removed.
+  bool is_empty_without(const Position& position,
+                        const int particle_index,
+                        const Configuration& config) const;
+
   /// Same as base class, but also prepare the cells.
   void precompute(Configuration * config) override;
 
@@ -56,10 +77,27 @@ class VisitModelCell : public VisitModel {
       Configuration * config,
       const int group_index) override;
 
+  /**
+    Same as base class, but for a single particle and a two body model,
+    the sites in the neighboring cells of each cell are only gathered once
+    for all candidates.
+   */
+  void compute_candidates(
+      Model * model,
+      const ModelParams& model_params,
+      const Select& selection,
+      const std::vector<std::vector<Position> >& candidates,
+      Configuration * config,
+      const int group_index,
+      std::vector<double> * energies) override;
+
   void finalize(const Select& select, Configuration * config) override;
 
   void check(const Configuration& config) const override;
 
+  /// Return the number of updates of the cell list.
+  int64_t num_updates() const override { return num_updates_; }
+
   std::shared_ptr<VisitModel> create(std::istream& istr) const override {
     return std::make_shared<VisitModelCell>(istr); }
   std::shared_ptr<VisitModel> create(argtype * args) const override {
@@ -79,8 +117,17 @@ class VisitModelCell : public VisitModel {
   // temporary and not serialized
   Select one_site_select_;
   double opt_r2_;
+  int64_t num_updates_ = 0;
+  std::vector<std::vector<int> > candidate_neighbors_;
+  std::vector<int64_t> candidate_stamps_;
+  int64_t num_candidate_calls_ = 0;
 
   void position_tracker_(const Select& select, Configuration * config);
+
+  // Return the particle and site indices, in pairs, of the sites in the
+  // neighboring cells, excluding the given particle.
+  const std::vector<int>& candidate_neighbors_of_(const int cell,
+                                                  const int particle_index);
 };
 
 inline std::shared_ptr<VisitModelCell> MakeVisitModelCell(
@@ -68,6 +68,9 @@ class VisitModelInner {
 
   double energy() const { return energy_; }
 
+  /// Return the number of pairs of sites with a computed distance.
+  int64_t num_pairs() const { return num_pairs_; }
+
   void revert(const Select& select) {
     // HWH optimize, maybe map_new doens't have to be same
     // or have to revert, but how to calc new clusters
@@ -102,6 +105,12 @@ class VisitModelInner {
       energy_map_->synchronize_(inner.energy_map(), perturbed);
     }
   }
+  bool is_synchronize_complete() const {
+    if (energy_map_) {
+      return energy_map_->is_synchronize_complete();
+    }
+    return true;
+  }
 
   int cutoff_index() const { return cutoff_index_; }
 
@@ -134,6 +143,7 @@ class VisitModelInner {
 
   // temporariy and not serialized
   bool skip_particle_ = false;
+  int64_t num_pairs_ = 0;
 };
 
 inline std::shared_ptr<VisitModelInner> MakeVisitModelInner() {
@@ -58,6 +58,30 @@ void Cells::build_neighbors_2D_() {
 
 void Cells::build_particles_() {
   particles_.resize(num_total());
+  build_empty_();
+}
+
+void Cells::build_empty_() {
+  empty_.clear();
+  empty_index_.assign(particles_.size(), -1);
+  for (int cell = 0; cell < static_cast<int>(particles_.size()); ++cell) {
+    update_empty_(cell);
+  }
+}
+
+void Cells::update_empty_(const int cell) {
+  const bool is_empty = particles_[cell].num_particles() == 0;
+  const int index = empty_index_[cell];
+  if (is_empty && index == -1) {
+    empty_index_[cell] = static_cast<int>(empty_.size());
+    empty_.push_back(cell);
+  } else if (!is_empty && index != -1) {
+    const int last = empty_.back();
+    empty_[index] = last;
+    empty_index_[last] = index;
+    empty_.pop_back();
+    empty_index_[cell] = -1;
+  }
 }
 
 int Cells::num_total() const {
@@ -143,6 +167,7 @@ Cells::Cells(std::istream& sstr) {
   feasst_deserialize(&neighbor_, sstr);
   feasst_deserialize(&group_, sstr);
   feasst_deserialize_fstobj(&particles_, sstr);
+  build_empty_();
 }
 
 }  // namespace feasst
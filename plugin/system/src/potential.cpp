@@ -152,6 +152,8 @@ double Potential::energy(Configuration * config) {
       stored_energy_ = model_->compute(group_index_, config, visit_model_.get());
     }
     cache_.load(stored_energy_);
+  } else {
+    ++num_cache_hits_;
   }
   return stored_energy_;
 }
@@ -167,10 +169,21 @@ double Potential::select_energy(const Select& select, Configuration * config) {
                                        visit_model_.get());
     }
     cache_.load(stored_energy_);
+  } else {
+    ++num_cache_hits_;
   }
   return stored_energy_;
 }
 
+void Potential::select_energies(const Select& select,
+    const std::vector<std::vector<Position> >& candidates,
+    Configuration * config,
+    std::vector<double> * energies) {
+  ASSERT(visit_model_, "visitor must be set.");
+  visit_model_->compute_candidates(model_.get(), model_params(*config), select,
+    candidates, config, group_index_, energies);
+}
+
 int Potential::cell_index() const {
   ASSERT(visit_model_->class_name() == "VisitModelCell", "error");
   return group_index();
@@ -2,7 +2,9 @@
 #include <string>
 #include "system/include/potential_factory.h"
 #include "utils/include/debug.h"
+#include "utils/include/io.h"
 #include "utils/include/serialize.h"
+#include "utils/include/profile.h"
 #include "math/include/constants.h"
 #include "math/include/utils_math.h"
 
@@ -10,11 +12,26 @@ namespace feasst {
 
 void PotentialFactory::add(std::shared_ptr<Potential> potential) {
   potentials_.push_back(potential);
+  profile_sections_.clear();
 }
 
 void PotentialFactory::set(const int index,
                            std::shared_ptr<Potential> potential) {
   potentials_[index] = potential;
+  profile_sections_.clear();
+}
+
+// Profile each potential by index, so that potentials of the same Model are
+// not combined.
+int PotentialFactory::profile_section_(const int index) {
+  if (profile_sections_.size() != potentials_.size()) {
+    profile_sections_.resize(potentials_.size());
+    for (int pot = 0; pot < num(); ++pot) {
+      profile_sections_[pot] = Profile::section("Potential" + feasst::str(pot)
+        + ":" + potentials_[pot]->model().class_name());
+    }
+  }
+  return profile_sections_[index];
 }
 
 void PotentialFactory::precompute(Configuration * config) {
@@ -33,6 +50,7 @@ double PotentialFactory::energy(Configuration * config) {
   double en = 0;
   int index = 0;
   while ((index < num()) && (opt_overlap_ == 0 || (en < NEAR_INFINITY/10.))) {
+    FEASST_PROFILE_SECTION(profile_section_(index));
     const double potential_en = potentials_[index]->energy(config);
     DEBUG("potential index: " << index << " potential energy: " << potential_en);
     en += potential_en;
@@ -50,6 +68,7 @@ double PotentialFactory::select_energy(const Select& select, Configuration * con
   while ((index < static_cast<int>(potentials_.size())) &&
          (opt_overlap_ == 0 || (en < NEAR_INFINITY))) {
     DEBUG("index " << index);
+    FEASST_PROFILE_SECTION(profile_section_(index));
     en += potentials_[index]->select_energy(select, config);
     ++index;
   }
@@ -58,6 +77,20 @@ double PotentialFactory::select_energy(const Select& select, Configuration * con
   return en;
 }
 
+void PotentialFactory::select_energies(const Select& select,
+    const std::vector<std::vector<Position> >& candidates,
+    Configuration * config,
+    std::vector<double> * energies) {
+  energies->assign(candidates.size(), 0.);
+  for (int pot = 0; pot < num(); ++pot) {
+    FEASST_PROFILE_SECTION(profile_section_(pot));
+    potentials_[pot]->select_energies(select, candidates, config, &energies_);
+    for (int index = 0; index < static_cast<int>(energies_.size()); ++index) {
+      (*energies)[index] += energies_[index];
+    }
+  }
+}
+
 std::vector<double> PotentialFactory::stored_energy_profile() const {
   std::vector<double> en;
   for (const std::shared_ptr<Potential>& potential : potentials_) {
@@ -142,6 +175,15 @@ void PotentialFactory::synchronize_(const PotentialFactory& factory,
   }
 }
 
+bool PotentialFactory::is_synchronize_complete() const {
+  for (const std::shared_ptr<Potential>& potential : potentials_) {
+    if (!potential->is_synchronize_complete()) {
+      return false;
+    }
+  }
+  return true;
+}
+
 void PotentialFactory::change_volume(const double delta_volume,
     const int dimension) {
   for (int index = 0; index < num(); ++index) {
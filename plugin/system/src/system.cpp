@@ -149,6 +149,20 @@ double System::perturbed_energy(const Select& select, const int config) {
   return en + bond_en;
 }
 
+void System::perturbed_energies(const Select& select,
+    const std::vector<std::vector<Position> >& candidates,
+    std::vector<double> * energies,
+    const int config) {
+  ref_used_last_ = -1;
+  potentials_(config)->select_energies(select, candidates,
+                                       &configurations_[config], energies);
+  bonds_[config].compute_all(select, configurations_[config]);
+  const double bond_en = bonds_[config].energy();
+  for (double& energy : *energies) {
+    energy += bond_en;
+  }
+}
+
 double System::reference_energy(const int ref, const int config) {
   ref_used_last_ = ref;
   DEBUG("ref_used_last_ " << ref_used_last_);
@@ -304,6 +318,24 @@ void System::synchronize_(const System& system, const Select& perturbed) {
   }
 }
 
+bool System::is_synchronize_complete() const {
+  if (num_configurations() != 1) {
+    return false;
+  }
+  for (int config = 0; config < num_configurations(); ++config) {
+    if (!unoptimized_[config].is_synchronize_complete() ||
+        !optimized_[config].is_synchronize_complete()) {
+      return false;
+    }
+    for (int ref = 0; ref < num_references(config); ++ref) {
+      if (!references_[config][ref].is_synchronize_complete()) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
 void System::change_volume(const double delta_volume, argtype * args) {
   const int config = integer("configuration", args, 0);
   const int dimen = integer("dimension", args, -1);
@@ -265,6 +265,51 @@ void VisitModel::compute_between_selection(
   }
 }
 
+void VisitModel::store_candidates_(const Select& selection,
+    const Configuration& config) {
+  original_ = selection;
+  original_.load_positions(config.particles());
+  candidate_ = original_;
+}
+
+void VisitModel::load_candidate_(const std::vector<Position>& candidate,
+    Configuration * config) {
+  ASSERT(static_cast<int>(candidate.size()) == candidate_.num_sites(),
+    "candidate size: " << candidate.size() << " != number of sites: "
+    << candidate_.num_sites());
+  int index = 0;
+  for (int select_index = 0; select_index < candidate_.num_particles();
+       ++select_index) {
+    for (int site = 0; site < candidate_.num_sites(select_index); ++site) {
+      candidate_.set_site_position(select_index, site, candidate[index]);
+      ++index;
+    }
+  }
+  config->update_positions(candidate_);
+}
+
+void VisitModel::restore_candidates_(Configuration * config) {
+  config->update_positions(original_);
+}
+
+void VisitModel::compute_candidates(
+    Model * model,
+    const ModelParams& model_params,
+    const Select& selection,
+    const std::vector<std::vector<Position> >& candidates,
+    Configuration * config,
+    const int group_index,
+    std::vector<double> * energies) {
+  energies->resize(candidates.size());
+  store_candidates_(selection, *config);
+  for (int index = 0; index < static_cast<int>(candidates.size()); ++index) {
+    load_candidate_(candidates[index], config);
+    (*energies)[index] = model->compute(model_params, selection, group_index,
+                                        config, this);
+  }
+  restore_candidates_(config);
+}
+
 void VisitModel::check_energy(
     Model * model,
     Configuration * config,
@@ -2,6 +2,7 @@
 #include "utils/include/io.h"
 #include "utils/include/serialize.h"
 #include "math/include/utils_math.h"
+#include "math/include/random.h"
 #include "configuration/include/domain.h"
 #include "configuration/include/configuration.h"
 #include "system/include/model_two_body.h"
@@ -57,6 +58,58 @@ int VisitModelCell::cell_id_opt_(const Domain& domain,
   return cells_.id(opt_rel_.coord());
 }
 
+double VisitModelCell::cell_volume(const Domain& domain) const {
+  return domain.volume()/static_cast<double>(cells_.num_total());
+}
+
+void VisitModelCell::random_position_in_empty_cell(const Domain& domain,
+    Random * random,
+    Position * position) const {
+  ASSERT(cells_.num_empty() > 0, "no empty cells");
+  int cell = cells_.empty()[random->uniform(0, cells_.num_empty() - 1)];
+  const int dimension = domain.dimension();
+  position->set_to_origin(dimension);
+  for (int dim = 0; dim < dimension; ++dim) {
+    const int num = cells_.num(dim);
+    const int index = cell % num;
+    cell /= num;
+    position->set_coord(dim, domain.side_length(dim)*(
+      (static_cast<double>(index) + random->uniform())/
+      static_cast<double>(num) - 0.5));
+  }
+}
+
+int VisitModelCell::num_empty_without(const int particle_index,
+    const Configuration& config) const {
+  int num_empty = cells_.num_empty();
+  const Particle& part = config.select_particle(particle_index);
+  std::vector<int> counted;
+  for (int site_index = 0; site_index < part.num_sites(); ++site_index) {
+    const Site& site = part.site(site_index);
+    if (cells_.type() < site.num_cells()) {
+      const int cell = site.cell(cells_.type());
+      const Select& in_cell = cells_.particles()[cell];
+      if (in_cell.num_particles() == 1 &&
+          in_cell.particle_index(0) == particle_index &&
+          !find_in_list(cell, counted)) {
+        counted.push_back(cell);
+        ++num_empty;
+      }
+    }
+  }
+  return num_empty;
+}
+
+bool VisitModelCell::is_empty_without(const Position& position,
+    const int particle_index,
+    const Configuration& config) const {
+  const Select& in_cell =
+    cells_.particles()[cell_id(config.domain(), position)];
+  return in_cell.num_particles() == 0 ||
+    (in_cell.num_particles() == 1 &&
+     in_cell.particle_index(0) == particle_index);
+}
+
 void VisitModelCell::precompute(Configuration * config) {
   VisitModel::precompute(config);
   ASSERT(config->domain().side_lengths().size() > 0,
@@ -269,8 +322,88 @@ void VisitModelCell::compute(
   set_energy(inner().energy());
 }
 
+const std::vector<int>& VisitModelCell::candidate_neighbors_of_(
+    const int cell,
+    const int particle_index) {
+  std::vector<int> * neighbors = &candidate_neighbors_[cell];
+  if (candidate_stamps_[cell] != num_candidate_calls_) {
+    neighbors->clear();
+    for (int cell2_index : cells_.neighbor()[cell]) {
+      const Select& cell2_parts = cells_.particles()[cell2_index];
+      for (int select2_index = 0;
+           select2_index < cell2_parts.num_particles();
+           ++select2_index) {
+        const int part2_index = cell2_parts.particle_index(select2_index);
+        if (part2_index != particle_index) {
+          for (int site2_index : cell2_parts.site_indices(select2_index)) {
+            neighbors->push_back(part2_index);
+            neighbors->push_back(site2_index);
+          }
+        }
+      }
+    }
+    candidate_stamps_[cell] = num_candidate_calls_;
+  }
+  return *neighbors;
+}
+
+void VisitModelCell::compute_candidates(
+    Model * model,
+    const ModelParams& model_params,
+    const Select& selection,
+    const std::vector<std::vector<Position> >& candidates,
+    Configuration * config,
+    const int group_index,
+    std::vector<double> * energies) {
+  if (selection.num_particles() != 1 || model->num_body() != 2) {
+    VisitModel::compute_candidates(model, model_params, selection, candidates,
+                                   config, group_index, energies);
+    return;
+  }
+  ASSERT(group_index == group_index_, "not equivalent");
+  ModelTwoBody * two_body = static_cast<ModelTwoBody*>(model);
+  const Domain& domain = config->domain();
+  init_relative_(domain, &relative_, &pbc_);
+  const int num_cells = cells_.num_total();
+  if (static_cast<int>(candidate_stamps_.size()) != num_cells) {
+    candidate_neighbors_.resize(num_cells);
+    candidate_stamps_.assign(num_cells, -1);
+  }
+  ++num_candidate_calls_;
+  const int part1_index = selection.particle_index(0);
+  energies->resize(candidates.size());
+  store_candidates_(selection, *config);
+  for (int index = 0; index < static_cast<int>(candidates.size()); ++index) {
+    load_candidate_(candidates[index], config);
+    zero_energy();
+    const Particle& part1 = config->select_particle(part1_index);
+    bool is_cutoff = false;
+    for (int site1_index : selection.site_indices(0)) {
+      const int cell1_index = cell_id_opt_(domain,
+                                           part1.site(site1_index).position());
+      const std::vector<int>& neighbors =
+        candidate_neighbors_of_(cell1_index, part1_index);
+      for (int ineigh = 0; ineigh < static_cast<int>(neighbors.size());
+           ineigh += 2) {
+        get_inner_()->compute(part1_index, site1_index, neighbors[ineigh],
+                              neighbors[ineigh + 1], config, model_params,
+                              two_body, false, &relative_, &pbc_);
+        if ((energy_cutoff() != -1) && (inner().energy() > energy_cutoff())) {
+          is_cutoff = true;
+          break;
+        }
+      }
+      if (is_cutoff) break;
+    }
+    (*energies)[index] = inner().energy();
+  }
+  set_energy(inner().energy());
+  restore_candidates_(config);
+}
+
 void VisitModelCell::position_tracker_(const Select& select,
     Configuration * config) {
+  ++num_updates_;
   for (int spindex = 0; spindex < select.num_particles(); ++spindex) {
     const int particle_index = select.particle_index(spindex);
     for (const int site_index : select.site_indices(spindex)) {
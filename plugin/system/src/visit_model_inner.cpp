@@ -61,6 +61,7 @@ void VisitModelInner::compute(
     if (site2.is_physical()) {
       config->domain().wrap_opt(site1.position(), site2.position(), relative,
                                 pbc, &squared_distance_);
+      ++num_pairs_;
       const int type1 = site1.type();
       const int type2 = site2.type();
       const double cutoff = model_params.select(cutoff_index()).mixed_values()[type1][type2];
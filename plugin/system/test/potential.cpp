@@ -1,6 +1,11 @@
 #include <sstream>
 #include "utils/test/utils.h"
 #include "configuration/test/config_utils.h"
+#include "math/include/random_mt19937.h"
+#include "configuration/include/select.h"
+#include "configuration/include/domain.h"
+#include "system/include/lennard_jones.h"
+#include "system/include/visit_model_cell.h"
 #include "system/include/potential.h"
 
 namespace feasst {
@@ -25,4 +30,34 @@ TEST(Potential, model_params) {
   EXPECT_EQ(5, potential->model_params().select("cutoff").value(1));
 }
 
+TEST(Potential, select_energies) {
+  RandomMT19937 random(argtype({{"seed", "123"}}));
+  for (std::shared_ptr<VisitModel> visitor :
+       std::vector<std::shared_ptr<VisitModel> >({MakeVisitModel(),
+         MakeVisitModelCell({{"min_length", "3"}})})) {
+    Configuration config = lj_sample4();
+    auto potential = MakePotential(MakeLennardJones(), visitor);
+    potential->precompute(&config);
+    const int part = 5;
+    Select select(part, config.select_particle(part));
+    const Position original = config.select_particle(part).site(0).position();
+    std::vector<std::vector<Position> > candidates(20, std::vector<Position>(1));
+    for (std::vector<Position>& candidate : candidates) {
+      random.position_in_cube(3, config.domain().side_length(0),
+                              &candidate[0]);
+    }
+    std::vector<double> energies;
+    potential->select_energies(select, candidates, &config, &energies);
+    EXPECT_EQ(20, static_cast<int>(energies.size()));
+    EXPECT_TRUE(original.is_equal(
+      config.select_particle(part).site(0).position()));
+    for (int index = 0; index < static_cast<int>(candidates.size()); ++index) {
+      select.set_site_position(0, 0, candidates[index][0]);
+      config.update_positions(select);
+      EXPECT_NEAR(energies[index], potential->select_energy(select, &config),
+                  1e-10);
+    }
+  }
+}
+
 }  // namespace feasst
@@ -0,0 +1,145 @@
+
+#ifndef FEASST_UTILS_PROFILE_H_
+#define FEASST_UTILS_PROFILE_H_
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace feasst {
+
+/**
+  Hierarchical profile of the time spent in sections of the code, such as the
+  selection, perturbation, acceptance and finalization of each Trial, and the
+  energy of each Potential.
+
+  Sections are timed with the FEASST_PROFILE(name) macro, which records the
+  steady_clock time until the end of the enclosing scope.
+  Each name is registered once with an identifier, so that timing a section
+  only indexes vectors.
+  FEASST_PROFILE(name) registers its name once per call site, so the name
+  must be the same for every call.
+  Otherwise, register the names in advance with Profile::section and use
+  FEASST_PROFILE_SECTION(identifier).
+  Sections which begin inside of another are recorded as its children, so
+  that the path of a section is, for example,
+  "TrialTranslate/perturb/Potential0:LennardJones".
+  Each thread has its own profile, which is kept after the thread ends, and
+  the profiles of all threads may be summed with merged().
+  Sections of other threads that are in progress during merged() are not
+  included, and their times may be read while being updated, so merge when
+  the other threads are idle for an exact sum.
+
+  Profiling is compiled out unless FEASST_PROFILE_ is defined (e.g., with
+  the cmake option -DUSE_PROFILE=ON).
+  Otherwise, FEASST_PROFILE does nothing, and its argument is not evaluated.
+  See ProfileHotPaths to periodically write the profile.
+ */
+class Profile {
+ public:
+  /// Return the profile of the current thread.
+  static Profile& thread_profile();
+
+  /// Return the identifier of a section name, which is the same for all
+  /// threads.
+  /// Register the name if it is not yet registered.
+  static int section(const std::string& name);
+
+  /// Return the sum of the profiles of all threads, by path.
+  static Profile merged();
+
+  /// Reset the profiles of all threads.
+  static void reset_all();
+
+  /// Add the times and counts of another profile, by path.
+  void add(const Profile& profile);
+
+  /// Begin a section, given the identifier of its name, as a child of the
+  /// current section, and return its index.
+  int begin(const int section);
+
+  /// End the section of the given index and record the elapsed time.
+  void end(const int index, const int64_t nanoseconds);
+
+  /// Return the number of sections.
+  int num() const { return static_cast<int>(path_.size()); }
+
+  /// Return the path of a section.
+  const std::string& path(const int index) const { return path_[index]; }
+
+  /// Return the index of the parent of a section, or -1 if none.
+  int parent(const int index) const { return parent_[index]; }
+
+  /// Return the number of times a section was timed.
+  int64_t count(const int index) const { return count_[index]; }
+
+  /// Return the total time in seconds of a section.
+  double seconds(const int index) const {
+    return 1e-9*static_cast<double>(nanoseconds_[index]); }
+
+  /// Return the index of the section with the given path, or -1 if none.
+  int index(const std::string& path) const;
+
+  /// Reset the times and counts of all sections.
+  void reset();
+
+  /// Return a table of the sections, sorted by path, with the number of
+  /// calls, the total time, and the percentage of the time of the parent.
+  std::string str() const;
+
+ private:
+  std::vector<std::string> path_;
+  std::vector<int> parent_;
+  std::vector<int> section_;
+  std::vector<int64_t> nanoseconds_;
+  std::vector<int64_t> count_;
+  // The index of each child, by index of the parent + 1 and by section.
+  // Absent children are -1.
+  std::vector<std::vector<int> > children_ = std::vector<std::vector<int> >(1);
+  int current_ = -1;
+
+  int child_(const int parent, const int section) const;
+  int add_child_(const int parent, const int section, const std::string& name);
+};
+
+/// Time a section of the Profile until the end of the scope.
+class ProfileScope {
+ public:
+  explicit ProfileScope(const int section)
+    : profile_(&Profile::thread_profile()),
+      index_(profile_->begin(section)),
+      begin_(std::chrono::steady_clock::now()) {}
+
+  ~ProfileScope() {
+    profile_->end(index_, std::chrono::duration_cast<std::chrono::nanoseconds>(
+      std::chrono::steady_clock::now() - begin_).count());
+  }
+
+ private:
+  Profile * profile_;
+  int index_;
+  std::chrono::steady_clock::time_point begin_;
+};
+
+#define FEASST_PROFILE_CONCAT2_(a, b) a##b
+#define FEASST_PROFILE_CONCAT_(a, b) FEASST_PROFILE_CONCAT2_(a, b)
+
+/// Time the remainder of the scope as a section of the Profile.
+#ifdef FEASST_PROFILE_
+# define FEASST_PROFILE_SECTION(section) \
+  feasst::ProfileScope FEASST_PROFILE_CONCAT_(feasst_profile_scope_, \
+                                              __LINE__)(section)
+# define FEASST_PROFILE(name) \
+  static const int FEASST_PROFILE_CONCAT_(feasst_profile_section_, __LINE__) \
+    = feasst::Profile::section(name); \
+  FEASST_PROFILE_SECTION(FEASST_PROFILE_CONCAT_(feasst_profile_section_, \
+                                                __LINE__))
+#else  // FEASST_PROFILE_
+# define FEASST_PROFILE_SECTION(section)
+# define FEASST_PROFILE(name)
+#endif  // FEASST_PROFILE_
+
+}  // namespace feasst
+
+#endif  // FEASST_UTILS_PROFILE_H_
@@ -0,0 +1,163 @@
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include "utils/include/profile.h"
+
+namespace feasst {
+
+// The profiles of all threads, which outlive the threads, the names of the
+// sections, and the mutex that guards these and the addition of sections to
+// any profile.
+static std::vector<std::shared_ptr<Profile> >& profiles_() {
+  static std::vector<std::shared_ptr<Profile> > profiles;
+  return profiles;
+}
+static std::vector<std::string>& section_names_() {
+  static std::vector<std::string> names;
+  return names;
+}
+static std::mutex& profiles_mutex_() {
+  static std::mutex mutex;
+  return mutex;
+}
+
+Profile& Profile::thread_profile() {
+  static thread_local Profile * profile = nullptr;
+  if (!profile) {
+    std::lock_guard<std::mutex> lock(profiles_mutex_());
+    profiles_().push_back(std::make_shared<Profile>());
+    profile = profiles_().back().get();
+  }
+  return *profile;
+}
+
+int Profile::section(const std::string& name) {
+  std::lock_guard<std::mutex> lock(profiles_mutex_());
+  std::vector<std::string> * names = &section_names_();
+  const auto found = std::find(names->begin(), names->end(), name);
+  if (found != names->end()) {
+    return static_cast<int>(found - names->begin());
+  }
+  names->push_back(name);
+  return static_cast<int>(names->size()) - 1;
+}
+
+Profile Profile::merged() {
+  std::lock_guard<std::mutex> lock(profiles_mutex_());
+  Profile sum;
+  for (const std::shared_ptr<Profile>& profile : profiles_()) {
+    sum.add(*profile);
+  }
+  return sum;
+}
+
+void Profile::reset_all() {
+  std::lock_guard<std::mutex> lock(profiles_mutex_());
+  for (const std::shared_ptr<Profile>& profile : profiles_()) {
+    profile->reset();
+  }
+}
+
+int Profile::child_(const int parent, const int section) const {
+  const std::vector<int>& children = children_[parent + 1];
+  if (section < static_cast<int>(children.size())) {
+    return children[section];
+  }
+  return -1;
+}
+
+int Profile::add_child_(const int parent, const int section,
+                        const std::string& name) {
+  const int index = num();
+  std::vector<int> * children = &children_[parent + 1];
+  if (section >= static_cast<int>(children->size())) {
+    children->resize(section + 1, -1);
+  }
+  (*children)[section] = index;
+  children_.emplace_back();
+  if (parent == -1) {
+    path_.push_back(name);
+  } else {
+    path_.push_back(path_[parent] + "/" + name);
+  }
+  parent_.push_back(parent);
+  section_.push_back(section);
+  nanoseconds_.push_back(0);
+  count_.push_back(0);
+  return index;
+}
+
+int Profile::begin(const int section) {
+  int index = child_(current_, section);
+  if (index == -1) {
+    std::lock_guard<std::mutex> lock(profiles_mutex_());
+    index = add_child_(current_, section, section_names_()[section]);
+  }
+  current_ = index;
+  return index;
+}
+
+void Profile::add(const Profile& profile) {
+  // parents precede their children, so their indices are known.
+  std::vector<int> index_of(profile.num());
+  for (int other = 0; other < profile.num(); ++other) {
+    const int other_parent = profile.parent(other);
+    const int parent = other_parent == -1 ? -1 : index_of[other_parent];
+    const int section = profile.section_[other];
+    int index = child_(parent, section);
+    if (index == -1) {
+      std::string name = profile.path(other);
+      if (other_parent != -1) {
+        name = name.substr(profile.path(other_parent).size() + 1);
+      }
+      index = add_child_(parent, section, name);
+    }
+    index_of[other] = index;
+    nanoseconds_[index] += profile.nanoseconds_[other];
+    count_[index] += profile.count_[other];
+  }
+}
+
+void Profile::end(const int index, const int64_t nanoseconds) {
+  nanoseconds_[index] += nanoseconds;
+  ++count_[index];
+  current_ = parent_[index];
+}
+
+int Profile::index(const std::string& path) const {
+  for (int index = 0; index < num(); ++index) {
+    if (path_[index] == path) {
+      return index;
+    }
+  }
+  return -1;
+}
+
+void Profile::reset() {
+  std::fill(nanoseconds_.begin(), nanoseconds_.end(), 0);
+  std::fill(count_.begin(), count_.end(), 0);
+}
+
+std::string Profile::str() const {
+  std::vector<int> order(num());
+  for (int index = 0; index < num(); ++index) {
+    order[index] = index;
+  }
+  std::sort(order.begin(), order.end(),
+    [this](const int a, const int b) { return path_[a] < path_[b]; });
+  std::stringstream ss;
+  ss << "path,calls,seconds,percent_of_parent" << std::endl;
+  for (const int index : order) {
+    ss << path_[index] << "," << count_[index] << "," << seconds(index) << ",";
+    const int par = parent_[index];
+    if (par != -1 && nanoseconds_[par] > 0) {
+      ss << 100.*static_cast<double>(nanoseconds_[index])/
+                 static_cast<double>(nanoseconds_[par]);
+    }
+    ss << std::endl;
+  }
+  return ss.str();
+}
+
+}  // namespace feasst
@@ -0,0 +1,71 @@
+#include <thread>
+#include "utils/test/utils.h"
+#include "utils/include/profile.h"
+
+namespace feasst {
+
+TEST(Profile, hierarchy) {
+  Profile profile;
+  const int translate = Profile::section("TrialTranslate");
+  const int perturb = Profile::section("perturb");
+  EXPECT_EQ(translate, Profile::section("TrialTranslate"));
+  EXPECT_NE(translate, perturb);
+  for (int trial = 0; trial < 2; ++trial) {
+    const int outer = profile.begin(translate);
+    const int inner = profile.begin(perturb);
+    profile.end(inner, 3);
+    profile.end(outer, 4);
+  }
+  const int outer = profile.begin(Profile::section("TrialRotate"));
+  profile.end(outer, 1);
+  EXPECT_EQ(3, profile.num());
+  const int index = profile.index("TrialTranslate/perturb");
+  EXPECT_EQ(1, index);
+  EXPECT_EQ(0, profile.parent(index));
+  EXPECT_EQ(-1, profile.parent(profile.index("TrialRotate")));
+  EXPECT_EQ(2, profile.count(index));
+  EXPECT_DOUBLE_EQ(6e-9, profile.seconds(index));
+  EXPECT_DOUBLE_EQ(8e-9, profile.seconds(0));
+  EXPECT_EQ(-1, profile.index("perturb"));
+  const std::string table = profile.str();
+  EXPECT_NE(std::string::npos, table.find("TrialTranslate/perturb,2,6e-09,75"));
+  profile.reset();
+  EXPECT_EQ(0, profile.count(index));
+  EXPECT_EQ(3, profile.num());
+}
+
+TEST(Profile, scope) {
+  Profile * profile = &Profile::thread_profile();
+  profile->reset();
+  {
+    ProfileScope outer(Profile::section("outer"));
+    ProfileScope inner(Profile::section("inner"));
+  }
+  const int index = profile->index("outer/inner");
+  ASSERT_NE(-1, index);
+  EXPECT_EQ(1, profile->count(index));
+  EXPECT_GE(profile->seconds(profile->index("outer")),
+            profile->seconds(index));
+}
+
+TEST(Profile, merged) {
+  Profile::reset_all();
+  std::thread thread([]() {
+    ProfileScope outer(Profile::section("merged_outer"));
+    ProfileScope inner(Profile::section("inner"));
+  });
+  thread.join();
+  {
+    ProfileScope outer(Profile::section("merged_outer"));
+  }
+  const Profile sum = Profile::merged();
+  const int outer = sum.index("merged_outer");
+  ASSERT_NE(-1, outer);
+  EXPECT_EQ(2, sum.count(outer));
+  EXPECT_EQ(1, sum.count(sum.index("merged_outer/inner")));
+  EXPECT_EQ(outer, sum.parent(sum.index("merged_outer/inner")));
+  Profile::reset_all();
+  EXPECT_EQ(0, Profile::merged().count(outer));
+}
+
+}  // namespace feasst